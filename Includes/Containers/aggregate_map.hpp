@@ -0,0 +1,318 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aggregate_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:31:48 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:05:12 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AGGREGATE_MAP_HPP
+# define AGGREGATE_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+
+# include "map.hpp"
+# include "../Utils/aggregate_node.hpp"
+
+/*
+
+Aggregate_map are ft::map whose tree nodes also cache the monoid ( see 
+aggregate_node.hpp ) of the mapped values of their subtree :
+	- aggregate( lo , hi ) combines, in key order, the mapped values of 
+	  every element with a key in [lo, hi[ in O(log n), whatever the number 
+	  of elements in the window,
+	- aggregate() combines the whole map in O(1).
+Everything else is ft::map over aggregate_node, the tree keeping the caches 
+up to date on insert, erase, split and join.
+Mapped values must change through the map for the caches to follow : 
+iterators are constant, and operator[] is replaced by insert_or_assign(). 
+The map base is private, so no map reference can reach operator[] either : 
+its members that cannot write a mapped value are brought back one by one.
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/map/map/?kw=map
+	Introduction to Algorithms (Cormen, Leiserson, Rivest, Stein), chapter 14
+
+*/
+
+namespace ft
+{
+	template< class Key , class T , class Monoid = sum_monoid< T > , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > >
+	class aggregate_map : private map< Key , T , Compare , Allocator , aggregate_node< const Key , T , Monoid > >
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef map< Key , T , Compare , Allocator , aggregate_node< const Key , T , Monoid > >	map_type;
+			typedef typename map_type::key_type									key_type;
+			typedef typename map_type::mapped_type								mapped_type;
+			typedef typename map_type::value_type								value_type;
+			typedef typename map_type::key_compare								key_compare;
+			typedef typename map_type::allocator_type							allocator_type;
+			typedef typename map_type::reference								reference;
+			typedef typename map_type::const_reference							const_reference;
+			typedef typename map_type::pointer									pointer;
+			typedef typename map_type::const_pointer							const_pointer;
+			typedef typename map_type::iterator									iterator;
+			typedef typename map_type::const_iterator							const_iterator;
+			typedef typename map_type::reverse_iterator							reverse_iterator;
+			typedef typename map_type::const_reverse_iterator					const_reverse_iterator;
+			typedef typename map_type::difference_type							difference_type;
+			typedef typename map_type::size_type								size_type;
+			typedef typename map_type::value_compare							value_compare;
+			typedef typename map_type::node_type								node_type;
+			typedef typename map_type::nodePtr									nodePtr;
+			typedef typename map_type::basePtr									basePtr;
+			typedef typename map_type::data_tree								data_tree;
+			typedef Monoid														monoid_type;
+			typedef typename Monoid::value_type									aggregate_type;
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  (1) Default Constructor  //
+			explicit aggregate_map( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() ) : \
+					map_type( comp , alloc )
+			{
+				return ;
+			}
+
+			//  (2) Range Constructor : sorted input is built in O(n)  //
+			template< class InputIterator >
+			aggregate_map( InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) 
+				: map_type( first , last , comp , alloc )
+			{
+				return ;
+			}
+
+			//  (2 bis) Sorted Range Constructor : [first, last[ must be sorted by key without duplicates, built in O(n) without comparison  //
+			template< class InputIterator >
+			aggregate_map( sorted_unique_t , InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) 
+				: map_type( sorted_unique , first , last , comp , alloc )
+			{
+				return ;
+			}
+
+			//  (3) Copy Constructor : node-for-node copy of x tree, caches included  //
+			aggregate_map( const aggregate_map& x ) : map_type( x )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+			
+			~aggregate_map( void )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+			
+			aggregate_map& operator=( const aggregate_map& x )
+			{
+				map_type::operator=( x );
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	ft::map members				 								  */
+			/* -------------------------------------------------------------- */
+
+			//  Iterators are constant : none of these can write a mapped value behind the caches  //
+			using map_type::begin;
+			using map_type::end;
+			using map_type::rbegin;
+			using map_type::rend;
+			using map_type::empty;
+			using map_type::size;
+			using map_type::max_size;
+			using map_type::insert;
+			using map_type::erase;
+			using map_type::clear;
+			using map_type::key_comp;
+			using map_type::value_comp;
+			using map_type::find;
+			using map_type::count;
+			using map_type::lower_bound;
+			using map_type::upper_bound;
+			using map_type::equal_range;
+			using map_type::nth;
+			using map_type::rank;
+			using map_type::get_allocator;
+
+			/* -------------------------------------------------------------- */
+			/* 	Element access				 								  */
+			/* -------------------------------------------------------------- */
+
+			//  insert_or_assign() : inserts ( k , obj ), or gives obj to the element with key k and pulls its path again  //
+			//  Stands in for operator[], whose reference would let caches go stale  //
+			pair< iterator , bool >	insert_or_assign( const key_type& k , const mapped_type& obj )
+			{
+				basePtr	parent;
+				bool	right;
+				basePtr	found = this->_tree.insert_position( k , parent , right );
+
+				if ( !found )
+					return ( pair< iterator , bool >( iterator( this->_tree.insert_at( parent , right , value_type( k , obj ) ) ) , true ) );
+				static_cast< nodePtr >( found )->couple.second = obj;
+				this->_tree.pull_path( found );
+				return ( pair< iterator , bool >( iterator( found ) , false ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  swap() : ft::map::swap() between two aggregate_map, O(1)  //
+			void	swap( aggregate_map& x )
+			{
+				map_type::swap( x );
+				return ;
+			}
+
+			//  split() : ft::map::split() into an aggregate_map, both sides' caches are pulled while relinking  //
+			void	split( const key_type& k , aggregate_map& out )
+			{
+				this->_tree.split( k , out._tree );
+				return ;
+			}
+
+			//  join() : ft::map::join() of another aggregate_map, caches are pulled up the spine it hangs on  //
+			bool	join( aggregate_map& x )
+			{
+				return ( this->_tree.join( x._tree ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Aggregation					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) aggregate() : monoid of every mapped value in key order, cached at the root, O(1)  //
+			aggregate_type	aggregate( void ) const
+			{
+				return ( node_type::subtree_aggregate( this->_tree.root() ) );
+			}
+
+			//  (2) aggregate() : monoid of the mapped values whose key is in [lo, hi[, in key order, O(log n)  //
+			//  Down from the first node inside the window, the path to lo adds whole right subtrees on the left side and  //
+			//  the path to hi adds whole left subtrees on the right side  //
+			aggregate_type	aggregate( const key_type& lo , const key_type& hi ) const
+			{
+				Monoid			op;
+				basePtr			split = this->_tree.root();
+				basePtr			current;
+				aggregate_type	left_part = op.identity();
+				aggregate_type	right_part = op.identity();
+
+				if ( !this->_comp( lo , hi ) )
+					return ( op.identity() );
+				while ( split && ( this->_comp( data_tree::key( split ) , lo ) || !this->_comp( data_tree::key( split ) , hi ) ) )
+					split = ( this->_comp( data_tree::key( split ) , lo ) ) ? split->right : split->left;
+				if ( !split )
+					return ( op.identity() );
+				for ( current = split->left ; current ; )
+				{
+					if ( !this->_comp( data_tree::key( current ) , lo ) )
+					{
+						left_part = op( op( static_cast< nodePtr >( current )->couple.second , node_type::subtree_aggregate( current->right ) ) , left_part );
+						current = current->left;
+					}
+					else
+						current = current->right;
+				}
+				for ( current = split->right ; current ; )
+				{
+					if ( this->_comp( data_tree::key( current ) , hi ) )
+					{
+						right_part = op( right_part , op( node_type::subtree_aggregate( current->left ) , static_cast< nodePtr >( current )->couple.second ) );
+						current = current->right;
+					}
+					else
+						current = current->left;
+				}
+				return ( op( op( left_part , static_cast< nodePtr >( split )->couple.second ) , right_part ) );
+			}
+
+	}; /* class aggregate_map */
+
+	/* -------------------------------------------------------------------------*/
+	/*																			*/
+	/* 			 NON-MEMBER FUNCTIONS OVERLOADS									*/
+	/*																			*/
+	/* -------------------------------------------------------------------------*/
+
+	//  (1) Operator ==  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	bool	operator==( const aggregate_map< Key , T , Monoid , Compare , Alloc >& lhs , const aggregate_map< Key , T , Monoid , Compare , Alloc >& rhs )
+	{
+		return ( lhs.size() == rhs.size() && ft::equal( lhs.begin() , lhs.end() , rhs.begin() ) );
+	}
+
+	//  (2) Operator !=  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	bool	operator!=( const aggregate_map< Key , T , Monoid , Compare , Alloc >& lhs , const aggregate_map< Key , T , Monoid , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs == rhs ) );
+	}
+
+	//  (3) Operator <  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	bool	operator<( const aggregate_map< Key , T , Monoid , Compare , Alloc >& lhs , const aggregate_map< Key , T , Monoid , Compare , Alloc >& rhs )
+	{
+		return ( ft::lexicographical_compare( lhs.begin() , lhs.end() , rhs.begin() , rhs.end() ) );
+	}
+
+	//  (4) Operator <=  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	bool	operator<=( const aggregate_map< Key , T , Monoid , Compare , Alloc >& lhs , const aggregate_map< Key , T , Monoid , Compare , Alloc >& rhs )
+	{
+		return ( !( rhs < lhs ) );
+	}
+
+	//  (5) Operator >  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	bool	operator>( const aggregate_map< Key , T , Monoid , Compare , Alloc >& lhs , const aggregate_map< Key , T , Monoid , Compare , Alloc >& rhs )
+	{
+		return ( rhs < lhs );
+	}
+
+	//  (6) Operator >=  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	bool	operator>=( const aggregate_map< Key , T , Monoid , Compare , Alloc >& lhs , const aggregate_map< Key , T , Monoid , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs < rhs ) );
+	}
+
+	//  swap() : exchanges x content by y's ( same type )  //
+	template< class Key , class T , class Monoid , class Compare , class Alloc >
+	void	swap( aggregate_map< Key , T , Monoid , Compare , Alloc >& x , aggregate_map< Key , T , Monoid , Compare , Alloc >& y )
+	{
+		x.swap( y );
+		return ;
+	}
+
+} /* namespace ft */
+
+#endif /* AGGREGATE_MAP_HPP */
@@ -0,0 +1,498 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree_map.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:40:52 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/17 11:40:52 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_MAP_HPP
+# define BTREE_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+
+# include "../Utils/algorithm.hpp"
+# include "../Utils/utility.hpp"
+# include "../Utils/btree.hpp"
+# include "../Utils/iterator.hpp"
+
+/*
+
+Btree_map are associative containers with the interface of ft::map, stored in 
+a B+ tree instead of a binary one :
+	- many values share one node sized to a few cache lines, so lookups 
+	  and scans touch far fewer cache lines than one node per value,
+	- values are kept in chained leaves, iterating is a walk over 
+	  contiguous arrays.
+Unlike ft::map, values move between nodes as the tree grows or shrinks : 
+insert and erase invalidate every iterator and reference to the container.
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/map/map/?kw=map
+	https://abseil.io/about/design/btree
+
+*/
+
+namespace ft
+{
+	template< class Key , class T , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > >
+	class btree_map
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef Key															key_type;
+			typedef T															mapped_type;
+			typedef ft::pair< const key_type , mapped_type >					value_type;
+			typedef Compare														key_compare;
+			typedef Allocator													allocator_type;
+			typedef typename allocator_type::reference							reference;
+			typedef typename allocator_type::const_reference					const_reference;
+			typedef typename allocator_type::pointer							pointer;
+			typedef typename allocator_type::const_pointer						const_pointer;
+			typedef btree< Key , T , key_compare , allocator_type >				data_tree;
+			typedef typename data_tree::iterator								iterator;
+			typedef typename data_tree::const_iterator							const_iterator;
+			typedef typename ft::reverse_iterator< iterator >					reverse_iterator;
+			typedef typename ft::reverse_iterator< const_iterator >				const_reverse_iterator;
+			typedef typename ft::iterator_traits< iterator >::difference_type	difference_type;
+			typedef typename allocator_type::size_type							size_type;
+			typedef typename data_tree::leafPtr									leafPtr;
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 ATTRIBUTES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+		private :
+
+			Allocator	_alloc;		// allocator object
+			Compare		_comp;		// btree_map::key_compare
+			data_tree	_tree;		// used B+ tree
+
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) Default Constructor  //
+			explicit btree_map( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() ) : \
+					_alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
+			{
+				return ;
+			}
+
+			//  (2) Range Constructor : sorted input is appended to the last leaf, filling nodes completely  //
+			template< class InputIterator >
+			btree_map( InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+				: _alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
+			{
+				this->insert( first , last );
+				return ;
+			}
+
+			//  (3) Copy Constructor : node-for-node copy of x tree, O(n) without comparison  //
+			btree_map( const btree_map& x ) : _alloc( x._alloc ) , _comp( x._comp ) , _tree( x._comp , x._alloc )
+			{
+				this->_tree.assign( x._tree );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+
+			~btree_map( void )
+			{
+				this->clear();
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+
+			//  Node-for-node copy of x tree  //
+			btree_map& operator=( const btree_map& x )
+			{
+				if ( this != &x )
+				{
+					this->_comp = x._comp;
+					this->_tree.assign( x._tree );
+				}
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Iterators					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) begin : returns iterator pointing to the first element (first slot of first leaf)  //
+			iterator begin( void )
+			{
+				return ( this->_tree.begin() );
+			}
+
+			//  (2) const begin : returns const iterator pointing to the first element  //
+			const_iterator begin( void ) const
+			{
+				return ( const_iterator( this->_tree.begin() ) );
+			}
+
+			//  (1) end : returns iterator referring to the past-the-end element (one past the last slot of last leaf)  //
+			iterator end( void )
+			{
+				return ( this->_tree.end() );
+			}
+
+			//  (2) const end : returns const iterator referring to the past-the-end element  //
+			const_iterator end( void ) const
+			{
+				return ( const_iterator( this->_tree.end() ) );
+			}
+
+			//  (1) rbegin : returns reverse iterator pointing the last element  //
+			reverse_iterator rbegin( void )
+			{
+				return ( reverse_iterator( this->end() ) );
+			}
+
+			//  (2) const rbegin : returns const reverse iterator pointing the last element  //
+			const_reverse_iterator rbegin( void ) const
+			{
+				return ( const_reverse_iterator( this->end() ) );
+			}
+
+			//  (1) rend : returns reverse iterator pointing to theoretical element preceding the first element  //
+			reverse_iterator rend( void )
+			{
+				return ( reverse_iterator( this->begin() ) );
+			}
+
+			//  (2) const rend : returns reverse iterator pointing to theoretical element preceding the first element  //
+			const_reverse_iterator rend( void ) const
+			{
+				return ( const_reverse_iterator( this->begin() ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Capacity					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : returns whether container is empty (i.e. whether its size is 0) //
+			bool empty( void ) const
+			{
+				return ( this->_tree.empty() );
+			}
+
+			//  size() : returns the number of elements in container  //
+			size_type size( void ) const
+			{
+				return ( this->_tree.size() );
+			}
+
+			//  max_size() : returns maximum number of elements that container can hold  //
+			size_type max_size( void ) const
+			{
+				return ( this->_alloc.max_size() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Element access				 								  */
+			/* -------------------------------------------------------------- */
+
+			//  Operator[] : returns reference to the mapped value of k, inserting a default one if k is missing  //
+			//  Single descent : mapped value is only default-constructed when k is missing  //
+			mapped_type& operator[]( const key_type& k )
+			{
+				leafPtr		leaf;
+				size_type	pos;
+
+				if ( this->_tree.insert_position( k , leaf , pos ) )
+					return ( leaf->slot( pos )->second );
+				return ( this->_tree.insert_at( leaf , pos , value_type( k , mapped_type() ) )->second );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) single insert() : extends container by inserting a single new element increasing size by one  //
+			pair< iterator , bool >	insert( const value_type& val )
+			{
+				return ( this->_tree.insert( val ) );
+			}
+
+			//  (2) with hint insert() : no descent when val goes right before position in its leaf, or after the last element  //
+			iterator	insert( iterator position , const value_type& val )
+			{
+				return ( this->_tree.insert_hint( position , val ) );
+			}
+
+			//  (3) range insert() : inserts elements from range [first, last[  //
+			//  Hinted at end() : sorted input is appended to the last leaf without a descent  //
+			template< class InputIterator >
+			void	insert( InputIterator first , InputIterator last )
+			{
+				while ( first != last )
+				{
+					this->_tree.insert_hint( this->_tree.end() , *first );
+					first++;
+				}
+				return ;
+			}
+
+			//  (1) erase() : removes from container the element at position  //
+			void	erase( iterator position )
+			{
+				this->_tree.erase_at( position );
+				return ;
+			}
+
+			//  (2) erase() : removes from container the element (if) with the key equivalent to k  //
+			size_type	erase( const key_type& k )
+			{
+				size_type	ret = 0;
+
+				if ( this->_tree.erase( k ) )
+				{
+					ret = 1;
+				}
+				return ( ret );
+			}
+
+			//  (3) erase() : removes from container a range of elements [first,last[  //
+			//  Rebalancing moves values, so last is turned into a count and first follows the next value  //
+			void	erase( iterator first , iterator last )
+			{
+				size_type	n = 0;
+
+				if ( first == this->begin() && last == this->end() )
+				{
+					this->clear();
+					return ;
+				}
+				for ( iterator ite = first ; ite != last ; ++ite )
+					++n;
+				while ( n-- )
+				{
+					first = this->_tree.erase_at( first );
+				}
+				return ;
+			}
+
+			//  swap() : exchanges container's content by the content of x, O(1)  //
+			void	swap( btree_map& x )
+			{
+				Allocator	tmp_alloc	= 	this->_alloc;
+				Compare		tmp_comp	= 	this->_comp;
+
+				this->_alloc 	=	x._alloc;
+				this->_comp		=	x._comp;
+
+				x._alloc	=	tmp_alloc;
+				x._comp		=	tmp_comp;
+
+				this->_tree.swap( x._tree );
+
+				return ;
+			}
+
+			//  clear() : removes all elements from the container (which are destroyed)  //
+			void	clear( void )
+			{
+				this->_tree.clear();
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Observers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  key_comp() : returns a copy of the container's comparison object to compare keys //
+			key_compare	key_comp( void ) const
+			{
+				return ( this->_comp );
+			}
+
+			//  class value_compare : compares two elements by key  //
+			class value_compare
+			{
+				friend class btree_map;
+
+				protected :
+
+					Compare	comp;
+					value_compare( Compare c ) : comp( c ) {}
+
+				public :
+
+					typedef bool		result_type;
+					typedef value_type 	first_argument_type;
+					typedef value_type 	second_argument_type;
+					bool operator()( const value_type& x , const value_type& y ) const
+					{
+						return ( comp( x.first , y.first ) );
+					}
+			};
+
+			//  value_comp() : returns a comparison object that can be used to compare two elements  //
+			value_compare	value_comp( void ) const
+			{
+				return ( value_compare( _comp) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operations					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) find() : searches container for an element with a key = k, returns end() if not found  //
+			iterator	find( const key_type& k )
+			{
+				return ( this->_tree.find( k ) );
+			}
+
+			//  (2) find() : same but const  //
+			const_iterator	find( const key_type& k ) const
+			{
+				return ( const_iterator( this->_tree.find( k ) ) );
+			}
+
+			//  count() : returns the number of elements with a key = k  //
+			size_type	count( const key_type& k ) const
+			{
+				if ( this->_tree.find( k ) == this->_tree.end() )
+				{
+					return ( 0 );
+				}
+				return ( 1 );
+			}
+
+			//  (1) lower_bound() : returns an iterator pointing to the first element whose key is not considered to go before k  //
+			iterator	lower_bound( const key_type& k )
+			{
+				return ( this->_tree.lower_bound( k ) );
+			}
+
+			//  (2) lower_bound() : same but const  //
+			const_iterator	lower_bound( const key_type& k ) const
+			{
+				return ( const_iterator( this->_tree.lower_bound( k ) ) );
+			}
+
+			//  (1) upper_bound : returns an iterator pointing to the first element whose key goes after k  //
+			iterator	upper_bound( const key_type& k )
+			{
+				return ( this->_tree.upper_bound( k ) );
+			}
+
+			//  (2) upper_bound : same but const  //
+			const_iterator	upper_bound( const key_type& k ) const
+			{
+				return ( const_iterator( this->_tree.upper_bound( k ) ) );
+			}
+
+			//  (1) equal_range : returns the bounds of the range of elements with a key = k  //
+			pair< const_iterator , const_iterator >	equal_range( const key_type& k ) const
+			{
+				ft::pair< iterator , iterator >	bounds = this->_tree.equal_range( k );
+
+				return ( pair< const_iterator , const_iterator >( bounds.first , bounds.second ));
+			}
+
+			//  (2) equal_range : same but not const  //
+			pair< iterator , iterator >	equal_range( const key_type& k )
+			{
+				return ( this->_tree.equal_range( k ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	 Allocator												 	  */
+			/* -------------------------------------------------------------- */
+
+			//  get_allocator() : returns a copy of allocator object associated with the container  //
+			allocator_type	get_allocator( void ) const
+			{
+				return ( this->_alloc );
+			}
+
+	}; /* class btree_map */
+
+	/* -------------------------------------------------------------------------*/
+	/*																			*/
+	/* 			 NON-MEMBER FUNCTIONS OVERLOADS									*/
+	/*																			*/
+	/* -------------------------------------------------------------------------*/
+
+	//  (1) Operator ==  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator==( const btree_map< Key , T , Compare , Alloc >& lhs , const btree_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( lhs.size() == rhs.size() && ft::equal( lhs.begin() , lhs.end() , rhs.begin() ));
+	}
+
+	//  (2) Operator !=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator!=( const btree_map< Key , T , Compare , Alloc >& lhs, const btree_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs == rhs ) );
+	}
+
+	//  (3) Operator <  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator<( const btree_map< Key , T , Compare , Alloc >& lhs , const btree_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( ft::lexicographical_compare( lhs.begin(), lhs.end() , rhs.begin() , rhs.end() ));
+	}
+
+	//  (4) Operator <=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator<=( const btree_map< Key , T , Compare , Alloc >& lhs , const btree_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( rhs < lhs ));
+	}
+
+	//  (5) Operator >  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator>( const btree_map< Key , T , Compare , Alloc >& lhs , const btree_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( rhs < lhs );
+	}
+
+	//  (6) Operator >=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator>=( const btree_map< Key , T , Compare , Alloc >& lhs , const btree_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs < rhs ) );
+	}
+
+	//  swap() : exchanges x content by y's ( same type )  //
+	template< class Key , class T , class Compare , class Alloc >
+	void	swap( btree_map< Key , T , Compare , Alloc >& x , btree_map< Key , T , Compare , Alloc >& y )
+	{
+		x.swap( y );
+		return ;
+	}
+
+} /* namespace ft */
+
+#endif /* BTREE_MAP_HPP */
@@ -0,0 +1,492 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:40:52 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 17:02:14 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+# include <new>
+# include <stdexcept>
+# include <pthread.h>
+
+# include "map.hpp"
+# include "vector.hpp"
+# include "../Utils/utility.hpp"
+# include "../Utils/hash.hpp"
+
+/*
+
+Concurrent_map are associative containers safe to share between threads. 
+Keys are spread by hash over a power of two number of shards, each one an 
+ft::map behind its own reader/writer lock :
+	- find(), count() and for_each() take shared locks, readers of a shard 
+	  never wait for each other, and threads working on different shards 
+	  never meet,
+	- insert(), erase() and update() lock one shard exclusively,
+	- for_each_ordered() holds every shard shared at once and merges them 
+	  in key order, it sees a consistent state of the whole map.
+No iterator nor reference goes out of a lock : lookups copy the mapped 
+value out, and changes in place go through update(). Functors given to 
+update() and for_each*() run under a lock and must not call the map back. 
+Keys equivalent for Compare must have the same Hash.
+
+Unless otherwise indicated all refs come from :
+	https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_rdlock.html
+	The Art of Multiprocessor Programming (Herlihy, Shavit), chapter 13
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 LOCK GUARDS												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  shared_lock_guard : read lock held for the guard lifetime  //
+	class shared_lock_guard
+	{
+		public :
+
+			explicit shared_lock_guard( pthread_rwlock_t& lock ) : _lock( &lock )
+			{
+				pthread_rwlock_rdlock( this->_lock );
+				return ;
+			}
+
+			~shared_lock_guard( void )
+			{
+				pthread_rwlock_unlock( this->_lock );
+				return ;
+			}
+
+		private :
+
+			pthread_rwlock_t*	_lock;
+
+			shared_lock_guard( const shared_lock_guard& );
+			shared_lock_guard&	operator=( const shared_lock_guard& );
+	};
+
+	//  unique_lock_guard : write lock held for the guard lifetime  //
+	class unique_lock_guard
+	{
+		public :
+
+			explicit unique_lock_guard( pthread_rwlock_t& lock ) : _lock( &lock )
+			{
+				pthread_rwlock_wrlock( this->_lock );
+				return ;
+			}
+
+			~unique_lock_guard( void )
+			{
+				pthread_rwlock_unlock( this->_lock );
+				return ;
+			}
+
+		private :
+
+			pthread_rwlock_t*	_lock;
+
+			unique_lock_guard( const unique_lock_guard& );
+			unique_lock_guard&	operator=( const unique_lock_guard& );
+	};
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 CLASS CONCURRENT_MAP										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Hash = ft::hash< Key > , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > >
+	class concurrent_map
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef Key															key_type;
+			typedef T															mapped_type;
+			typedef ft::pair< const key_type , mapped_type >					value_type;
+			typedef Hash														hasher;
+			typedef Compare														key_compare;
+			typedef Allocator													allocator_type;
+			typedef typename allocator_type::size_type							size_type;
+			typedef ft::map< Key , T , Compare , Allocator >					map_type;
+			typedef typename map_type::iterator									map_iterator;
+			typedef typename map_type::const_iterator							map_const_iterator;
+
+			//  Shards start on a cache line and are padded to a multiple of it : a lock taken by one core does not slow down its neighbours  //
+			static const std::size_t	cache_line = 64;
+			static const size_type		default_shards = 16;
+
+		private :
+
+			struct shard
+			{
+				pthread_rwlock_t	lock;
+				map_type			map;
+				char				pad[ cache_line - ( sizeof( pthread_rwlock_t ) + sizeof( map_type ) ) % cache_line ];
+
+				shard( const key_compare& comp , const allocator_type& alloc ) : map( comp , alloc )
+				{
+					if ( pthread_rwlock_init( &this->lock , NULL ) )
+						throw ( std::runtime_error( "ft::concurrent_map" ) );
+					return ;
+				}
+
+				~shard( void )
+				{
+					pthread_rwlock_destroy( &this->lock );
+					return ;
+				}
+			};
+
+			//  std::allocator only guarantees the alignment of the widest scalar, shards are placed by hand in a larger char block  //
+			typedef typename Allocator::template rebind< char >::other		blockAlloc;
+
+			//  cursor : next element of one shard during an ordered merge  //
+			struct cursor
+			{
+				map_const_iterator	current;
+				map_const_iterator	last;
+
+				cursor( map_const_iterator first , map_const_iterator end ) : current( first ) , last( end ) {}
+			};
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 ATTRIBUTES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			char*		_block;		// raw storage, cache_line - 1 bytes larger than the shards
+			shard*		_shards;	// array of _count shards, first cache line aligned address of _block
+			size_type	_count;		// number of shards, a power of two
+			Hash		_hash;		// concurrent_map::hasher
+			Compare		_comp;		// concurrent_map::key_compare
+			blockAlloc	_alloc;		// block allocator
+
+			//  Not copyable : a copy of a map other threads write to is taken with for_each_ordered()  //
+			concurrent_map( const concurrent_map& );
+			concurrent_map&	operator=( const concurrent_map& );
+
+		public :
+		
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructor												   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  shards is rounded up to a power of two, about the number of threads writing at once is enough  //
+			explicit concurrent_map( size_type shards = default_shards , const hasher& hf = hasher() , const key_compare& comp = key_compare() , \
+					const allocator_type& alloc = allocator_type() ) : _block( NULL ) , _shards( NULL ) , _count( 1 ) , _hash( hf ) , _comp( comp ) , _alloc( alloc )
+			{
+				size_type	built = 0;
+
+				while ( this->_count < shards )
+					this->_count <<= 1;
+				this->_block = this->_alloc.allocate( this->block_size() );
+				this->_shards = reinterpret_cast< shard* >( ( reinterpret_cast< std::size_t >( this->_block ) + cache_line - 1 ) & ~( cache_line - 1 ) );
+				try
+				{
+					for ( ; built < this->_count ; ++built )
+						::new( static_cast< void* >( this->_shards + built ) ) shard( comp , alloc );
+				}
+				catch ( ... )
+				{
+					while ( built )
+						this->_shards[ --built ].~shard();
+					this->_alloc.deallocate( this->_block , this->block_size() );
+					throw ;
+				}
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  No other thread may use the map anymore  //
+			~concurrent_map( void )
+			{
+				for ( size_type i = 0 ; i < this->_count ; ++i )
+					this->_shards[ i ].~shard();
+				this->_alloc.deallocate( this->_block , this->block_size() );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Capacity					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : true if no shard holds an element ; shards are read one after the other, other threads may change them meanwhile  //
+			bool	empty( void ) const
+			{
+				for ( size_type i = 0 ; i < this->_count ; ++i )
+				{
+					shared_lock_guard	guard( this->_shards[ i ].lock );
+
+					if ( !this->_shards[ i ].map.empty() )
+						return ( false );
+				}
+				return ( true );
+			}
+
+			//  size() : sum of the shard sizes, read one after the other  //
+			size_type	size( void ) const
+			{
+				size_type	ret = 0;
+
+				for ( size_type i = 0 ; i < this->_count ; ++i )
+				{
+					shared_lock_guard	guard( this->_shards[ i ].lock );
+
+					ret += this->_shards[ i ].map.size();
+				}
+				return ( ret );
+			}
+
+			//  shard_count() : number of shards  //
+			size_type	shard_count( void ) const
+			{
+				return ( this->_count );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Lookup						 								  */
+			/* -------------------------------------------------------------- */
+
+			//  find() : copies the mapped value of key k into obj and returns true, false if k is not there  //
+			bool	find( const key_type& k , mapped_type& obj ) const
+			{
+				shard&				sh = this->shard_of( k );
+				shared_lock_guard	guard( sh.lock );
+				map_const_iterator	it = sh.map.find( k );
+
+				if ( it == sh.map.end() )
+					return ( false );
+				obj = it->second;
+				return ( true );
+			}
+
+			//  count() : 1 if key k is there, 0 otherwise  //
+			size_type	count( const key_type& k ) const
+			{
+				shard&				sh = this->shard_of( k );
+				shared_lock_guard	guard( sh.lock );
+
+				return ( sh.map.count( k ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  insert() : inserts val if its key is not there yet, returns true if it was inserted  //
+			bool	insert( const value_type& val )
+			{
+				shard&				sh = this->shard_of( val.first );
+				unique_lock_guard	guard( sh.lock );
+
+				return ( sh.map.insert( val ).second );
+			}
+
+			//  insert_or_assign() : inserts ( k , obj ) or gives obj to the element with key k, returns true if it was inserted  //
+			bool	insert_or_assign( const key_type& k , const mapped_type& obj )
+			{
+				shard&					sh = this->shard_of( k );
+				unique_lock_guard		guard( sh.lock );
+				pair< map_iterator , bool >	ret = sh.map.insert( value_type( k , obj ) );
+
+				if ( !ret.second )
+					ret.first->second = obj;
+				return ( ret.second );
+			}
+
+			//  update() : calls f( mapped value ) on the element with key k under the shard write lock, returns false if k is not there  //
+			template< class Function >
+			bool	update( const key_type& k , Function f )
+			{
+				shard&				sh = this->shard_of( k );
+				unique_lock_guard	guard( sh.lock );
+				map_iterator		it = sh.map.find( k );
+
+				if ( it == sh.map.end() )
+					return ( false );
+				f( it->second );
+				return ( true );
+			}
+
+			//  erase() : removes the element with key k, returns the number of elements erased  //
+			size_type	erase( const key_type& k )
+			{
+				shard&				sh = this->shard_of( k );
+				unique_lock_guard	guard( sh.lock );
+
+				return ( sh.map.erase( k ) );
+			}
+
+			//  clear() : empties the shards one after the other  //
+			void	clear( void )
+			{
+				for ( size_type i = 0 ; i < this->_count ; ++i )
+				{
+					unique_lock_guard	guard( this->_shards[ i ].lock );
+
+					this->_shards[ i ].map.clear();
+				}
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Traversal					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  for_each() : calls f( element ) shard after shard, each under its read lock : key order only inside a shard  //
+			template< class Function >
+			Function	for_each( Function f ) const
+			{
+				for ( size_type i = 0 ; i < this->_count ; ++i )
+				{
+					shared_lock_guard	guard( this->_shards[ i ].lock );
+
+					for ( map_const_iterator it = this->_shards[ i ].map.begin() ; it != this->_shards[ i ].map.end() ; ++it )
+						f( *it );
+				}
+				return ( f );
+			}
+
+			//  for_each_ordered() : calls f( element ) in key order over the whole map  //
+			//  Every shard is read locked, in index order as writers never hold two locks, then a binary heap of the  //
+			//  shards next elements merges them : O(n log s) for s shards  //
+			template< class Function >
+			Function	for_each_ordered( Function f ) const
+			{
+				ft::vector< cursor >	heap;
+				size_type				locked = 0;
+
+				//  No allocation once a lock is held : push_back() cannot throw between a lock and its count  //
+				heap.reserve( this->_count );
+				try
+				{
+					for ( ; locked < this->_count ; ++locked )
+					{
+						pthread_rwlock_rdlock( &this->_shards[ locked ].lock );
+						if ( !this->_shards[ locked ].map.empty() )
+							heap.push_back( cursor( this->_shards[ locked ].map.begin() , this->_shards[ locked ].map.end() ) );
+					}
+					for ( size_type i = heap.size() / 2 ; i > 0 ; --i )
+						this->sift_down( heap , i - 1 );
+					while ( !heap.empty() )
+					{
+						f( *heap[ 0 ].current );
+						if ( ++heap[ 0 ].current == heap[ 0 ].last )
+						{
+							heap[ 0 ] = heap.back();
+							heap.pop_back();
+						}
+						this->sift_down( heap , 0 );
+					}
+				}
+				catch ( ... )
+				{
+					this->unlock_shards( locked );
+					throw ;
+				}
+				this->unlock_shards( locked );
+				return ( f );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Observers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  hash_function() : returns a copy of the hash object  //
+			hasher	hash_function( void ) const
+			{
+				return ( this->_hash );
+			}
+
+			//  key_comp() : returns a copy of the comparison object  //
+			key_compare	key_comp( void ) const
+			{
+				return ( this->_comp );
+			}
+
+		private :
+
+			/* -------------------------------------------------------------- */
+			/* 	Helpers						 								  */
+			/* -------------------------------------------------------------- */
+
+			//  shard_of() : shard holding key k, picked by the mixed hash low bits  //
+			shard&	shard_of( const key_type& k ) const
+			{
+				return ( this->_shards[ ft::hash_mix( this->_hash( k ) ) & ( this->_count - 1 ) ] );
+			}
+
+			//  block_size() : bytes of _block, room to slide the shards up to a cache line boundary  //
+			size_type	block_size( void ) const
+			{
+				return ( this->_count * sizeof( shard ) + cache_line - 1 );
+			}
+
+			//  unlock_shards() : releases the read locks of the first n shards  //
+			void	unlock_shards( size_type n ) const
+			{
+				while ( n )
+					pthread_rwlock_unlock( &this->_shards[ --n ].lock );
+				return ;
+			}
+
+			//  sift_down() : moves heap[ i ] down until no child holds a smaller key  //
+			void	sift_down( ft::vector< cursor >& heap , size_type i ) const
+			{
+				size_type	n = heap.size();
+				size_type	child;
+
+				if ( i >= n )
+					return ;
+				cursor		tmp( heap[ i ] );
+
+				while ( ( child = 2 * i + 1 ) < n )
+				{
+					if ( child + 1 < n && this->_comp( heap[ child + 1 ].current->first , heap[ child ].current->first ) )
+						++child;
+					if ( !this->_comp( heap[ child ].current->first , heap[ i ].current->first ) )
+						break ;
+					tmp = heap[ i ];
+					heap[ i ] = heap[ child ];
+					heap[ child ] = tmp;
+					i = child;
+				}
+				return ;
+			}
+
+	}; /* class concurrent_map */
+
+} /* namespace ft */
+
+#endif /* CONCURRENT_MAP_HPP */
@@ -0,0 +1,718 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_skiplist_map.hpp                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:22:09 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:22:09 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef CONCURRENT_SKIPLIST_MAP_HPP
+# define CONCURRENT_SKIPLIST_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+# include <new>
+
+# include "../Utils/utility.hpp"
+# include "../Utils/iterator.hpp"
+# include "../Utils/epoch.hpp"
+
+/*
+
+Concurrent_skiplist_map are ordered associative containers any number of 
+threads may read and write at once, without lock :
+	- a skip list : sorted linked list at level 0, each node also linked 
+	  at the levels above it up to a random height ( 1/4 chance to go one 
+	  level up ), so a search skips most nodes, O(log n) expected,
+	- insert() links the new node at level 0 with one compare and swap, 
+	  then at the levels above, writers of different keys never wait for 
+	  each other,
+	- erase() marks the low bit of the node's links, top level first, 
+	  the mark at level 0 is the erase ; marked nodes are unlinked by 
+	  the next search going through them,
+	- find(), count() and iteration never write shared memory,
+	- an unlinked node is freed by epoch based reclamation ( see 
+	  epoch.hpp ), once no thread can be reading it anymore.
+Iterators are constant forward iterators in key order, erased elements are 
+skipped and elements inserted ahead of them may or may not be seen. An 
+iterator keeps its thread pinned, so nodes erased meanwhile are not freed 
+until it is destroyed : it stays in the thread that made it, and should not 
+be kept long. size() is exact only when no thread writes.
+
+Unless otherwise indicated all refs come from :
+	The Art of Multiprocessor Programming (Herlihy, Shavit), chapter 14.4
+	Practical lock-freedom (Fraser), 2004, section 4.3
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 STRUCT SKIPLIST_NODE										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  next[] is allocated with the node, levels entries long ; the low bit of next[ i ] marks the node erased at level i  //
+	template< class Key , class T >
+	struct skiplist_node : public epoch_node
+	{
+		ft::pair< const Key , T >	couple;		// data node, stored inline
+		int							levels;		// height of the node
+		int							owners;		// inserter and winning eraser not done with the node yet, retired at 0
+		skiplist_node*				next[ 1 ];	// links, one per level
+
+		skiplist_node( const ft::pair< const Key , T >& val , int height ) : couple( val ) , levels( height ) , owners( 2 )
+		{
+			return ;
+		}
+
+		//  bytes() : allocation size of a node of the given height  //
+		static std::size_t	bytes( int height )
+		{
+			return ( sizeof( skiplist_node ) + ( height - 1 ) * sizeof( skiplist_node* ) );
+		}
+
+		//  marked() : true if the link carries the erase mark  //
+		static bool	marked( skiplist_node* link )
+		{
+			return ( reinterpret_cast< std::size_t >( link ) & 1 );
+		}
+
+		//  mark() : link with the erase mark  //
+		static skiplist_node*	mark( skiplist_node* link )
+		{
+			return ( reinterpret_cast< skiplist_node* >( reinterpret_cast< std::size_t >( link ) | 1 ) );
+		}
+
+		//  strip() : link without the erase mark  //
+		static skiplist_node*	strip( skiplist_node* link )
+		{
+			return ( reinterpret_cast< skiplist_node* >( reinterpret_cast< std::size_t >( link ) & ~static_cast< std::size_t >( 1 ) ) );
+		}
+
+		//  load() : link at level i  //
+		skiplist_node*	load( int i ) const
+		{
+			return ( __atomic_load_n( &this->next[ i ] , __ATOMIC_ACQUIRE ) );
+		}
+
+		//  exchange() : compare and swap of the link at level i, expected gets the current link on failure  //
+		bool	exchange( int i , skiplist_node*& expected , skiplist_node* desired )
+		{
+			return ( __atomic_compare_exchange_n( &this->next[ i ] , &expected , desired , false , __ATOMIC_ACQ_REL , __ATOMIC_ACQUIRE ) );
+		}
+
+	}; /* struct skiplist_node */
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 SKIPLIST ITERATOR											  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  Forward iterator on level 0, pins its thread in the domain while it lives (NULL record for end())  //
+	template< class T , class Node >
+	class skiplist_iterator
+	{
+		public :
+
+			//  Members type  //
+			typedef ft::forward_iterator_tag	iterator_category;
+			typedef T							value_type;
+			typedef std::ptrdiff_t				difference_type;
+			typedef T*							pointer;
+			typedef T&							reference;
+
+			//  Attributes  //
+			Node*			_current;		// current node, NULL for end()
+			epoch_domain*	_domain;		// domain the thread is pinned in
+			epoch_record*	_rec;			// record pinned, NULL if none
+
+		/* -------------------------------------------------------------------*/
+		/* 			 MEMBER FUNCTIONS 										  */
+		/* -------------------------------------------------------------------*/
+
+			//  (1) Default constructor : end()  //
+			skiplist_iterator( void ) : _current( NULL ) , _domain( NULL ) , _rec( NULL )
+			{
+				return ;
+			}
+
+			//  (2) Pinning constructor : pins rec first, the node is set afterwards  //
+			skiplist_iterator( epoch_domain& domain , epoch_record* rec ) : _current( NULL ) , _domain( &domain ) , _rec( rec )
+			{
+				this->_domain->enter( this->_rec );
+				return ;
+			}
+
+			//  (3) Copy constructor : pins again  //
+			skiplist_iterator( const skiplist_iterator& x ) : _current( x._current ) , _domain( x._domain ) , _rec( x._rec )
+			{
+				if ( this->_rec )
+					this->_domain->enter( this->_rec );
+				return ;
+			}
+
+			//  Destructor  //
+			~skiplist_iterator( void )
+			{
+				if ( this->_rec )
+					this->_domain->leave( this->_rec );
+				return ;
+			}
+
+			//  Operator '=' overload : pins rhs record before leaving the current one  //
+			skiplist_iterator&	operator=( const skiplist_iterator& rhs )
+			{
+				if ( rhs._rec )
+					rhs._domain->enter( rhs._rec );
+				if ( this->_rec )
+					this->_domain->leave( this->_rec );
+				this->_current = rhs._current;
+				this->_domain = rhs._domain;
+				this->_rec = rhs._rec;
+				return ( *this );
+			}
+
+			//  skip() : first node from current on not erased at level 0  //
+			static Node*	skip( Node* current )
+			{
+				Node*	next;
+
+				while ( current && Node::marked( next = current->load( 0 ) ) )
+					current = Node::strip( next );
+				return ( current );
+			}
+
+			//  (1) Operator++ : pre-increment version  //
+			skiplist_iterator&	operator++( void )
+			{
+				this->_current = skip( Node::strip( this->_current->load( 0 ) ) );
+				return ( *this );
+			}
+
+			//  (2) Operator++ : post-increment version  //
+			skiplist_iterator	operator++( int )
+			{
+				skiplist_iterator	tmp = *this;
+
+				this->operator++();
+				return ( tmp );
+			}
+
+			//  Operator* : dereference iterator : returns a reference to element pointed to by iterator  //
+			T&	operator*( void ) const
+			{
+				return ( this->_current->couple );
+			}
+
+			//  Operator-> : dereference iterator, returns pointer to element pointed by iterator  //
+			T*	operator->( void ) const
+			{
+				return ( &this->_current->couple );
+			}
+
+			//  Operator ==  //
+			bool	operator==( const skiplist_iterator& rhs ) const
+			{
+				return ( this->_current == rhs._current );
+			}
+
+			//  Operator !=  //
+			bool	operator!=( const skiplist_iterator& rhs ) const
+			{
+				return ( this->_current != rhs._current );
+			}
+
+	}; /* class skiplist_iterator */
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 CLASS CONCURRENT_SKIPLIST_MAP								  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > >
+	class concurrent_skiplist_map
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef Key															key_type;
+			typedef T															mapped_type;
+			typedef ft::pair< const key_type , mapped_type >					value_type;
+			typedef Compare														key_compare;
+			typedef Allocator													allocator_type;
+			typedef typename allocator_type::size_type							size_type;
+			typedef skiplist_node< Key , T >									node_type;
+			typedef node_type*													nodePtr;
+			typedef skiplist_iterator< const value_type , node_type >			iterator;
+			typedef skiplist_iterator< const value_type , node_type >			const_iterator;
+			typedef typename ft::iterator_traits< iterator >::difference_type	difference_type;
+			typedef typename Allocator::template rebind< char >::other			byteAlloc;
+
+			//  4^16 elements before levels stop paying off  //
+			static const int	max_level = 16;
+
+		private :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 ATTRIBUTES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			nodePtr					_head;		// sentinel of max_level links, its couple is never built
+			size_type				_size;		// elements, updated atomically
+			Compare					_comp;		// key_compare
+			allocator_type			_alloc;		// allocator object
+			mutable byteAlloc		_bytes;		// node allocator
+			mutable epoch_domain	_domain;	// reclamation of erased nodes
+
+			//  Not copyable : nodes may be unlinked while they are read  //
+			concurrent_skiplist_map( const concurrent_skiplist_map& );
+			concurrent_skiplist_map&	operator=( const concurrent_skiplist_map& );
+
+		public :
+		
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  (1) Default Constructor  //
+			explicit concurrent_skiplist_map( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() ) : \
+					_head( NULL ) , _size( 0 ) , _comp( comp ) , _alloc( alloc ) , _bytes( alloc )
+			{
+				this->_head = reinterpret_cast< nodePtr >( this->_bytes.allocate( node_type::bytes( max_level ) ) );
+				for ( int i = 0 ; i < max_level ; ++i )
+					this->_head->next[ i ] = NULL;
+				return ;
+			}
+
+			//  (2) Range Constructor  //
+			template< class InputIterator >
+			concurrent_skiplist_map( InputIterator first , InputIterator last , const key_compare& comp = key_compare(), \
+					const allocator_type& alloc = allocator_type() ) : _head( NULL ) , _size( 0 ) , _comp( comp ) , _alloc( alloc ) , _bytes( alloc )
+			{
+				this->_head = reinterpret_cast< nodePtr >( this->_bytes.allocate( node_type::bytes( max_level ) ) );
+				for ( int i = 0 ; i < max_level ; ++i )
+					this->_head->next[ i ] = NULL;
+				try
+				{
+					this->insert( first , last );
+				}
+				catch ( ... )
+				{
+					this->destroy_all();
+					throw ;
+				}
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  No other thread may use the map anymore : linked nodes and retired ones are freed  //
+			~concurrent_skiplist_map( void )
+			{
+				this->destroy_all();
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Iterators					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  begin : returns iterator pointing to the first element  //
+			const_iterator	begin( void ) const
+			{
+				const_iterator	ret( this->_domain , this->_domain.record() );
+
+				ret._current = const_iterator::skip( node_type::strip( this->_head->load( 0 ) ) );
+				return ( ret );
+			}
+
+			//  end : returns iterator referring to the past-the-end element  //
+			const_iterator	end( void ) const
+			{
+				return ( const_iterator() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Capacity					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : returns whether no element is linked at level 0  //
+			bool	empty( void ) const
+			{
+				epoch_guard	guard( this->_domain , this->_domain.record() );
+
+				return ( !const_iterator::skip( node_type::strip( this->_head->load( 0 ) ) ) );
+			}
+
+			//  size() : returns the number of elements, exact when no thread writes  //
+			size_type	size( void ) const
+			{
+				return ( __atomic_load_n( &this->_size , __ATOMIC_RELAXED ) );
+			}
+
+			//  max_size() : returns maximum number of elements that the container can hold  //
+			size_type	max_size( void ) const
+			{
+				return ( this->_alloc.max_size() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) insert() : inserts val if its key is not there yet, returns true if it was inserted  //
+			//  Linked at level 0 first, which makes it visible, then level after level up to its height ; a level where  //
+			//  the node is already marked stops the climb  //
+			bool	insert( const value_type& val )
+			{
+				epoch_record*	rec = this->_domain.record();
+				epoch_guard		guard( this->_domain , rec );
+				nodePtr			preds[ max_level ];
+				nodePtr			succs[ max_level ];
+				nodePtr			node;
+				nodePtr			expected;
+				int				level;
+
+				if ( this->search( val.first , preds , succs ) )
+					return ( false );
+				node = this->new_node( val , this->random_level( rec ) );
+				while ( true )
+				{
+					for ( level = 0 ; level < node->levels ; ++level )
+						node->next[ level ] = succs[ level ];
+					expected = succs[ 0 ];
+					if ( preds[ 0 ]->exchange( 0 , expected , node ) )
+						break ;
+					if ( this->search( val.first , preds , succs ) )
+					{
+						this->delete_node( node );
+						return ( false );
+					}
+				}
+				__atomic_add_fetch( &this->_size , 1 , __ATOMIC_RELAXED );
+				for ( level = 1 ; level < node->levels ; ++level )
+				{
+					while ( true )
+					{
+						expected = node->load( level );
+						if ( node_type::marked( expected ) )
+							break ;
+						if ( expected != succs[ level ] && !node->exchange( level , expected , succs[ level ] ) )
+							continue ;
+						expected = succs[ level ];
+						if ( preds[ level ]->exchange( level , expected , node ) )
+							break ;
+						this->search( val.first , preds , succs );
+					}
+					if ( node_type::marked( node->load( level ) ) )
+						break ;
+				}
+				if ( node_type::marked( node->load( 0 ) ) )
+					this->search( val.first , preds , succs );
+				this->release( rec , node );
+				return ( true );
+			}
+
+			//  (2) range insert() : inserts elements from range [first, last[  //
+			template< class InputIterator >
+			void	insert( InputIterator first , InputIterator last )
+			{
+				while ( first != last )
+				{
+					this->insert( *first );
+					first++;
+				}
+				return ;
+			}
+
+			//  erase() : removes the element with key k, returns the number of elements erased  //
+			//  Links are marked from the top level down, whoever marks level 0 erased the element, then a search unlinks it  //
+			size_type	erase( const key_type& k )
+			{
+				epoch_record*	rec = this->_domain.record();
+				epoch_guard		guard( this->_domain , rec );
+				nodePtr			preds[ max_level ];
+				nodePtr			succs[ max_level ];
+				nodePtr			node;
+				nodePtr			next;
+
+				if ( !this->search( k , preds , succs ) )
+					return ( 0 );
+				node = succs[ 0 ];
+				for ( int level = node->levels - 1 ; level > 0 ; --level )
+				{
+					next = node->load( level );
+					while ( !node_type::marked( next ) && !node->exchange( level , next , node_type::mark( next ) ) )
+						;
+				}
+				next = node->load( 0 );
+				while ( !node_type::marked( next ) )
+				{
+					if ( node->exchange( 0 , next , node_type::mark( next ) ) )
+					{
+						__atomic_sub_fetch( &this->_size , 1 , __ATOMIC_RELAXED );
+						this->search( k , preds , succs );
+						this->release( rec , node );
+						return ( 1 );
+					}
+				}
+				return ( 0 );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Observers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  key_comp() : returns a copy of the container's comparison object to compare keys //
+			key_compare	key_comp( void ) const
+			{
+				return ( this->_comp );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operations					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) find() : iterator to the element with key k, end() if none  //
+			const_iterator	find( const key_type& k ) const
+			{
+				const_iterator	ret( this->_domain , this->_domain.record() );
+
+				ret._current = this->lookup( k );
+				if ( ret._current && this->_comp( k , ret._current->couple.first ) )
+					ret._current = NULL;
+				return ( ret );
+			}
+
+			//  (2) find() : copies the mapped value of key k into obj and returns true, false if k is not there  //
+			bool	find( const key_type& k , mapped_type& obj ) const
+			{
+				epoch_guard	guard( this->_domain , this->_domain.record() );
+				nodePtr		node = this->lookup( k );
+
+				if ( !node || this->_comp( k , node->couple.first ) )
+					return ( false );
+				obj = node->couple.second;
+				return ( true );
+			}
+
+			//  count() : 1 if key k is there, 0 otherwise  //
+			size_type	count( const key_type& k ) const
+			{
+				epoch_guard	guard( this->_domain , this->_domain.record() );
+				nodePtr		node = this->lookup( k );
+
+				return ( node && !this->_comp( k , node->couple.first ) );
+			}
+
+			//  lower_bound() : returns an iterator pointing to the first element whose key is not considered to go before k  //
+			const_iterator	lower_bound( const key_type& k ) const
+			{
+				const_iterator	ret( this->_domain , this->_domain.record() );
+
+				ret._current = this->lookup( k );
+				return ( ret );
+			}
+
+			//  upper_bound() : returns an iterator pointing to the first element whose key goes after k  //
+			const_iterator	upper_bound( const key_type& k ) const
+			{
+				const_iterator	ret( this->_domain , this->_domain.record() );
+
+				ret._current = this->lookup( k );
+				if ( ret._current && !this->_comp( k , ret._current->couple.first ) )
+					++ret;
+				return ( ret );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	 Allocator												 	  */
+			/* -------------------------------------------------------------- */
+
+			//  get_allocator() : returns a copy of allocator object associated with the map  //
+			allocator_type	get_allocator( void ) const
+			{
+				return ( this->_alloc );
+			}
+
+		private :
+
+			/* -------------------------------------------------------------- */
+			/* 	Search						 								  */
+			/* -------------------------------------------------------------- */
+
+			//  search() : fills preds / succs at each level around k, unlinking the marked nodes met, true if k is at succs[ 0 ]  //
+			//  A failed unlink means preds changed under us : start again from the top  //
+			bool	search( const key_type& k , nodePtr* preds , nodePtr* succs ) const
+			{
+				nodePtr	pred;
+				nodePtr	current;
+				nodePtr	next;
+
+			retry :
+				pred = this->_head;
+				for ( int level = max_level - 1 ; level >= 0 ; --level )
+				{
+					current = node_type::strip( pred->load( level ) );
+					while ( current )
+					{
+						next = current->load( level );
+						if ( node_type::marked( next ) )
+						{
+							nodePtr	expected = current;
+
+							if ( !pred->exchange( level , expected , node_type::strip( next ) ) )
+								goto retry ;
+							current = node_type::strip( next );
+							continue ;
+						}
+						if ( !this->_comp( current->couple.first , k ) )
+							break ;
+						pred = current;
+						current = next;
+					}
+					preds[ level ] = pred;
+					succs[ level ] = current;
+				}
+				return ( succs[ 0 ] && !this->_comp( k , succs[ 0 ]->couple.first ) );
+			}
+
+			//  lookup() : first node not erased whose key does not go before k, NULL if none ; reads only, the caller is pinned  //
+			nodePtr	lookup( const key_type& k ) const
+			{
+				nodePtr	pred = this->_head;
+				nodePtr	current = NULL;
+				nodePtr	next;
+
+				for ( int level = max_level - 1 ; level >= 0 ; --level )
+				{
+					current = node_type::strip( pred->load( level ) );
+					while ( current )
+					{
+						next = current->load( level );
+						if ( node_type::marked( next ) )
+						{
+							current = node_type::strip( next );
+							continue ;
+						}
+						if ( !this->_comp( current->couple.first , k ) )
+							break ;
+						pred = current;
+						current = next;
+					}
+				}
+				return ( current );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Nodes						 								  */
+			/* -------------------------------------------------------------- */
+
+			//  random_level() : height of a new node, each level up has one chance in four  //
+			int	random_level( epoch_record* rec ) const
+			{
+				std::size_t	bits;
+				int			level = 1;
+
+				rec->seed ^= rec->seed << 13;
+				rec->seed ^= rec->seed >> 7;
+				rec->seed ^= rec->seed << 17;
+				for ( bits = rec->seed ; level < max_level && !( bits & 3 ) ; bits >>= 2 )
+					++level;
+				return ( level );
+			}
+
+			//  new_node() : node holding a copy of val, links left unset  //
+			nodePtr	new_node( const value_type& val , int height )
+			{
+				char*	raw = this->_bytes.allocate( node_type::bytes( height ) );
+
+				try
+				{
+					return ( ::new( static_cast< void* >( raw ) ) node_type( val , height ) );
+				}
+				catch ( ... )
+				{
+					this->_bytes.deallocate( raw , node_type::bytes( height ) );
+					throw ;
+				}
+			}
+
+			//  delete_node() : destroys and frees node  //
+			void	delete_node( nodePtr node ) const
+			{
+				std::size_t	size = node_type::bytes( node->levels );
+
+				node->~node_type();
+				this->_bytes.deallocate( reinterpret_cast< char* >( node ) , size );
+				return ;
+			}
+
+			//  release() : the inserter, or the eraser once the node is unlinked, is done with node ; the second one retires it, then  //
+			//  the nodes of rec old enough are freed  //
+			void	release( epoch_record* rec , nodePtr node )
+			{
+				epoch_node*	ready;
+				epoch_node*	tmp;
+
+				if ( __atomic_sub_fetch( &node->owners , 1 , __ATOMIC_ACQ_REL ) )
+					return ;
+				this->_domain.retire( rec , node );
+				for ( ready = this->_domain.collect( rec ) ; ready ; ready = tmp )
+				{
+					tmp = ready->retired_next;
+					this->delete_node( static_cast< nodePtr >( ready ) );
+				}
+				return ;
+			}
+
+			//  destroy_all() : frees the nodes still linked, the retired ones and the head  //
+			void	destroy_all( void )
+			{
+				nodePtr		current = node_type::strip( this->_head->next[ 0 ] );
+				nodePtr		next;
+				epoch_node*	ready;
+				epoch_node*	tmp;
+
+				for ( ; current ; current = next )
+				{
+					next = node_type::strip( current->next[ 0 ] );
+					this->delete_node( current );
+				}
+				for ( ready = this->_domain.drain() ; ready ; ready = tmp )
+				{
+					tmp = ready->retired_next;
+					this->delete_node( static_cast< nodePtr >( ready ) );
+				}
+				this->_bytes.deallocate( reinterpret_cast< char* >( this->_head ) , node_type::bytes( max_level ) );
+				return ;
+			}
+
+	}; /* class concurrent_skiplist_map */
+
+} /* namespace ft */
+
+#endif /* CONCURRENT_SKIPLIST_MAP_HPP */
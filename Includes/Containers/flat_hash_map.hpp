@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_hash_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:21:40 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 19:04:55 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef FLAT_HASH_MAP_HPP
+# define FLAT_HASH_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+
+# include "../Utils/utility.hpp"
+# include "../Utils/hash.hpp"
+# include "../Utils/hash_map_base.hpp"
+# include "../Utils/swiss_table.hpp"
+
+/*
+
+Flat_hash_map are associative containers with the interface of 
+ft::unordered_map, stored in a swiss table ( see swiss_table.hpp ) :
+	- elements are stored inline in one flat array, a control byte per 
+	  slot holds 7 bits of the hash of its key,
+	- a lookup compares 16 control bytes at once ( SSE2 ) and only then 
+	  the keys whose byte matches : a miss rarely compares a key,
+	- up to 7/8 of the slots are used before the table grows.
+Inserts may rebuild the table and invalidate iterators and references, 
+erases move nothing.
+Everything but erasing at iterators and the hash policy is shared with 
+the other hash maps ( see hash_map_base.hpp ).
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/unordered_map/unordered_map/
+	https://abseil.io/docs/cpp/guides/container
+
+*/
+
+namespace ft
+{
+	template< class Key , class T , class Hash = ft::hash< Key > , class KeyEqual = std::equal_to< Key > , \
+			class Allocator = std::allocator< pair< const Key , T > > >
+	class flat_hash_map : public hash_map_base< swiss_table< Key , T , Hash , KeyEqual , Allocator > >
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef hash_map_base< swiss_table< Key , T , Hash , KeyEqual , Allocator > >	base_type;
+			typedef typename base_type::value_type								value_type;
+			typedef typename base_type::hasher									hasher;
+			typedef typename base_type::key_equal								key_equal;
+			typedef typename base_type::allocator_type							allocator_type;
+			typedef typename base_type::data_table								data_table;
+			typedef typename base_type::iterator								iterator;
+			typedef typename base_type::const_iterator							const_iterator;
+			typedef typename base_type::size_type								size_type;
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) Default Constructor : room for n elements without growing  //
+			explicit flat_hash_map( size_type n = 0 , const hasher& hf = hasher() , const key_equal& eq = key_equal() , \
+					const allocator_type& alloc = allocator_type() ) : base_type( n , hf , eq , alloc )
+			{
+				return ;
+			}
+
+			//  (2) Range Constructor  //
+			template< class InputIterator >
+			flat_hash_map( InputIterator first , InputIterator last , size_type n = 0 , const hasher& hf = hasher() , \
+					const key_equal& eq = key_equal() , const allocator_type& alloc = allocator_type() ) : base_type( n , hf , eq , alloc )
+			{
+				this->insert( first , last );
+				return ;
+			}
+
+			//  (3) Copy Constructor : slot for slot copy, no hashing  //
+			flat_hash_map( const flat_hash_map& x ) : base_type( x )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+
+			~flat_hash_map( void )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+
+			flat_hash_map& operator=( const flat_hash_map& x )
+			{
+				base_type::operator=( x );
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (2) erase( k ) is hash_map_base's  //
+			using base_type::erase;
+
+			//  (1) erase() : removes the element at position, returns an iterator to the element that followed it  //
+			iterator	erase( const_iterator position )
+			{
+				size_type	i = position._ctrl - this->_table._ctrl;
+
+				this->_table.erase_slot( i );
+				return ( ++this->_table.at( i ) );
+			}
+
+			//  (3) erase() : removes a range of elements [first,last[  //
+			iterator	erase( const_iterator first , const_iterator last )
+			{
+				while ( first != last )
+					first = this->erase( first );
+				return ( iterator( const_cast< value_type* >( last._slot ) , last._ctrl ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Hash policy					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  bucket_count() : slots, 2^k - 1  //
+			size_type	bucket_count( void ) const
+			{
+				return ( this->_table._capacity );
+			}
+
+			//  load_factor() : size() / bucket_count()  //
+			float	load_factor( void ) const
+			{
+				return ( this->_table._capacity ? static_cast< float >( this->_table._size ) / this->_table._capacity : 0.0f );
+			}
+
+			//  max_load_factor() : load factor the table grows at, fixed to 7/8 : probes stop at empty bytes  //
+			float	max_load_factor( void ) const
+			{
+				return ( 0.875f );
+			}
+
+			//  rehash() : at least n buckets, and enough for size() ; deleted slots are dropped  //
+			void	rehash( size_type n )
+			{
+				size_type	capacity = data_table::capacity_for( this->_table._size );
+
+				while ( capacity < n )
+					capacity = capacity * 2 + 1;
+				if ( capacity != this->_table._capacity )
+					this->_table.resize( capacity );
+				return ;
+			}
+
+			//  reserve() : room for n elements without a rebuild  //
+			void	reserve( size_type n )
+			{
+				this->rehash( data_table::capacity_for( n ) );
+				return ;
+			}
+
+	}; /* class flat_hash_map */
+
+	//  Comparisons and swap() are hash_map_base's, found through the base class  //
+
+} /* namespace ft */
+
+#endif /* FLAT_HASH_MAP_HPP */
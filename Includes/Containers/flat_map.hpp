@@ -0,0 +1,685 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   flat_map.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 12:31:07 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/17 12:31:07 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FLAT_MAP_HPP
+# define FLAT_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+
+# include "../Utils/algorithm.hpp"
+# include "../Utils/utility.hpp"
+# include "../Utils/iterator.hpp"
+# include "vector.hpp"
+
+/*
+
+Flat_map are associative containers with the interface of ft::map, whose 
+elements are kept sorted by key in a single ft::vector :
+	- no node, no pointer : an element costs sizeof( value_type ), 
+	  iterating is a walk over one contiguous array,
+	- lookups are binary searches over that array,
+	- a range is built with one sort and one duplicate removal pass, so 
+	  a map built once and read many times is cheap to create.
+Inserting or erasing a single element shifts every element after it : 
+O(n), meant for maps that are mostly read. It invalidates every iterator.
+Elements are moved by assignment, so value_type is pair< Key , T > : the key 
+of an element must not be modified through an iterator.
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/map/map/?kw=map
+	https://www.boost.org/doc/libs/release/doc/html/container/non_standard_containers.html#container.non_standard_containers.flat_xxx
+
+*/
+
+namespace ft
+{
+	template< class Key , class T , class Compare = std::less< Key > , class Allocator = std::allocator< pair< Key , T > > >
+	class flat_map
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef Key															key_type;
+			typedef T															mapped_type;
+			typedef ft::pair< key_type , mapped_type >							value_type;
+			typedef Compare														key_compare;
+			typedef Allocator													allocator_type;
+			typedef typename allocator_type::reference							reference;
+			typedef typename allocator_type::const_reference					const_reference;
+			typedef typename allocator_type::pointer							pointer;
+			typedef typename allocator_type::const_pointer						const_pointer;
+			typedef ft::vector< value_type , allocator_type >					container_type;
+			typedef typename container_type::iterator							iterator;
+			typedef typename container_type::const_iterator						const_iterator;
+			typedef typename container_type::reverse_iterator					reverse_iterator;
+			typedef typename container_type::const_reverse_iterator				const_reverse_iterator;
+			typedef typename container_type::difference_type					difference_type;
+			typedef typename allocator_type::size_type							size_type;
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 ATTRIBUTES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+		private :
+
+			Compare			_comp;		// flat_map::key_compare
+			container_type	_data;		// elements sorted by key
+
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) Default Constructor  //
+			explicit flat_map( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() ) : \
+					_comp( comp ) , _data( alloc )
+			{
+				return ;
+			}
+
+			//  (2) Range Constructor : elements are appended, then sorted and deduplicated once  //
+			template< class InputIterator >
+			flat_map( InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+				: _comp( comp ) , _data( alloc )
+			{
+				this->insert( first , last );
+				return ;
+			}
+
+			//  (2 bis) Sorted Range Constructor : [first, last[ must be sorted by key without duplicates, copied as is  //
+			template< class InputIterator >
+			flat_map( sorted_unique_t , InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() )
+				: _comp( comp ) , _data( alloc )
+			{
+				for ( ; first != last ; ++first )
+					this->_data.push_back( *first );
+				return ;
+			}
+
+			//  (3) Copy Constructor  //
+			flat_map( const flat_map& x ) : _comp( x._comp ) , _data( x._data )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+
+			~flat_map( void )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+
+			flat_map& operator=( const flat_map& x )
+			{
+				if ( this != &x )
+				{
+					this->_comp = x._comp;
+					this->_data.assign( x._data.begin() , x._data.end() );
+				}
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Iterators					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) begin : returns iterator pointing to the first element  //
+			iterator begin( void )
+			{
+				return ( this->_data.begin() );
+			}
+
+			//  (2) const begin : returns const iterator pointing to the first element  //
+			const_iterator begin( void ) const
+			{
+				return ( this->_data.begin() );
+			}
+
+			//  (1) end : returns iterator referring to the past-the-end element  //
+			iterator end( void )
+			{
+				return ( this->_data.end() );
+			}
+
+			//  (2) const end : returns const iterator referring to the past-the-end element  //
+			const_iterator end( void ) const
+			{
+				return ( this->_data.end() );
+			}
+
+			//  (1) rbegin : returns reverse iterator pointing the last element  //
+			reverse_iterator rbegin( void )
+			{
+				return ( this->_data.rbegin() );
+			}
+
+			//  (2) const rbegin : returns const reverse iterator pointing the last element  //
+			const_reverse_iterator rbegin( void ) const
+			{
+				return ( this->_data.rbegin() );
+			}
+
+			//  (1) rend : returns reverse iterator pointing to theoretical element preceding the first element  //
+			reverse_iterator rend( void )
+			{
+				return ( this->_data.rend() );
+			}
+
+			//  (2) const rend : returns reverse iterator pointing to theoretical element preceding the first element  //
+			const_reverse_iterator rend( void ) const
+			{
+				return ( this->_data.rend() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Capacity					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : returns whether container is empty (i.e. whether its size is 0) //
+			bool empty( void ) const
+			{
+				return ( this->_data.empty() );
+			}
+
+			//  size() : returns the number of elements in container  //
+			size_type size( void ) const
+			{
+				return ( this->_data.size() );
+			}
+
+			//  max_size() : returns maximum number of elements that container can hold  //
+			size_type max_size( void ) const
+			{
+				return ( this->_data.max_size() );
+			}
+
+			//  capacity() : number of elements the underlying vector can hold without reallocating  //
+			size_type capacity( void ) const
+			{
+				return ( this->_data.capacity() );
+			}
+
+			//  reserve() : makes room for n elements in the underlying vector  //
+			void reserve( size_type n )
+			{
+				this->_data.reserve( n );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Element access				 								  */
+			/* -------------------------------------------------------------- */
+
+			//  Operator[] : returns reference to the mapped value of k, inserting a default one if k is missing  //
+			mapped_type& operator[]( const key_type& k )
+			{
+				iterator	ite = this->lower_bound( k );
+
+				if ( ite == this->end() || this->_comp( k , ite->first ) )
+					ite = this->_data.insert( ite , value_type( k , mapped_type() ) );
+				return ( ite->second );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) single insert() : binary search, then shift the following elements up  //
+			pair< iterator , bool >	insert( const value_type& val )
+			{
+				iterator	ite = this->lower_bound( val.first );
+
+				if ( ite != this->end() && !this->_comp( val.first , ite->first ) )
+					return ( pair< iterator , bool >( ite , false ) );
+				return ( pair< iterator , bool >( this->_data.insert( ite , val ) , true ) );
+			}
+
+			//  (2) with hint insert() : no search when val goes right before position  //
+			iterator	insert( iterator position , const value_type& val )
+			{
+				if ( ( position == this->end() || this->_comp( val.first , position->first ) )
+					&& ( position == this->begin() || this->_comp( ( position - 1 )->first , val.first ) ) )
+					return ( this->_data.insert( position , val ) );
+				return ( this->insert( val ).first );
+			}
+
+			//  (3) range insert() : appends [first, last[, sorts the new elements once and merges them in  //
+			//  Existing elements win over new ones with the same key, as with repeated single inserts  //
+			template< class InputIterator >
+			void	insert( InputIterator first , InputIterator last )
+			{
+				size_type	old_size = this->_data.size();
+
+				for ( ; first != last ; ++first )
+					this->_data.push_back( *first );
+				if ( this->_data.size() == old_size )
+					return ;
+				if ( !this->is_sorted_unique( old_size ) )
+					this->sort_range( old_size , this->_data.size() );
+				if ( old_size && this->_comp( this->_data[ old_size ].first , this->_data[ old_size - 1 ].first ) )
+					this->merge_range( old_size );
+				this->unique();
+				return ;
+			}
+
+			//  (1) erase() : removes from container the element at position  //
+			void	erase( iterator position )
+			{
+				this->_data.erase( position );
+				return ;
+			}
+
+			//  (2) erase() : removes from container the element (if) with the key equivalent to k  //
+			size_type	erase( const key_type& k )
+			{
+				iterator	ite = this->find( k );
+
+				if ( ite == this->end() )
+					return ( 0 );
+				this->_data.erase( ite );
+				return ( 1 );
+			}
+
+			//  (3) erase() : removes from container a range of elements [first,last[, one shift for the whole range  //
+			void	erase( iterator first , iterator last )
+			{
+				this->_data.erase( first , last );
+				return ;
+			}
+
+			//  swap() : exchanges container's content by the content of x, O(1)  //
+			void	swap( flat_map& x )
+			{
+				Compare		tmp_comp	= 	this->_comp;
+
+				this->_comp		=	x._comp;
+				x._comp			=	tmp_comp;
+				this->_data.swap( x._data );
+				return ;
+			}
+
+			//  clear() : removes all elements from the container (which are destroyed)  //
+			void	clear( void )
+			{
+				this->_data.clear();
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Observers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  key_comp() : returns a copy of the container's comparison object to compare keys //
+			key_compare	key_comp( void ) const
+			{
+				return ( this->_comp );
+			}
+
+			//  class value_compare : compares two elements by key  //
+			class value_compare
+			{
+				friend class flat_map;
+
+				protected :
+
+					Compare	comp;
+					value_compare( Compare c ) : comp( c ) {}
+
+				public :
+
+					typedef bool		result_type;
+					typedef value_type 	first_argument_type;
+					typedef value_type 	second_argument_type;
+					bool operator()( const value_type& x , const value_type& y ) const
+					{
+						return ( comp( x.first , y.first ) );
+					}
+			};
+
+			//  value_comp() : returns a comparison object that can be used to compare two elements  //
+			value_compare	value_comp( void ) const
+			{
+				return ( value_compare( _comp) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operations					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) find() : binary search for an element with a key = k, returns end() if not found  //
+			iterator	find( const key_type& k )
+			{
+				iterator	ite = this->lower_bound( k );
+
+				if ( ite != this->end() && !this->_comp( k , ite->first ) )
+					return ( ite );
+				return ( this->end() );
+			}
+
+			//  (2) find() : same but const  //
+			const_iterator	find( const key_type& k ) const
+			{
+				const_iterator	ite = this->lower_bound( k );
+
+				if ( ite != this->end() && !this->_comp( k , ite->first ) )
+					return ( ite );
+				return ( this->end() );
+			}
+
+			//  count() : returns the number of elements with a key = k  //
+			size_type	count( const key_type& k ) const
+			{
+				if ( this->find( k ) == this->end() )
+				{
+					return ( 0 );
+				}
+				return ( 1 );
+			}
+
+			//  (1) lower_bound() : returns an iterator pointing to the first element whose key is not considered to go before k  //
+			iterator	lower_bound( const key_type& k )
+			{
+				return ( this->begin() + this->lower_index( k ) );
+			}
+
+			//  (2) lower_bound() : same but const  //
+			const_iterator	lower_bound( const key_type& k ) const
+			{
+				return ( this->begin() + this->lower_index( k ) );
+			}
+
+			//  (1) upper_bound : returns an iterator pointing to the first element whose key goes after k  //
+			iterator	upper_bound( const key_type& k )
+			{
+				return ( this->begin() + this->upper_index( k ) );
+			}
+
+			//  (2) upper_bound : same but const  //
+			const_iterator	upper_bound( const key_type& k ) const
+			{
+				return ( this->begin() + this->upper_index( k ) );
+			}
+
+			//  (1) equal_range : returns the bounds of the range of elements with a key = k  //
+			pair< const_iterator , const_iterator >	equal_range( const key_type& k ) const
+			{
+				const_iterator	ite = this->lower_bound( k );
+
+				if ( ite != this->end() && !this->_comp( k , ite->first ) )
+					return ( pair< const_iterator , const_iterator >( ite , ite + 1 ) );
+				return ( pair< const_iterator , const_iterator >( ite , ite ) );
+			}
+
+			//  (2) equal_range : same but not const  //
+			pair< iterator , iterator >	equal_range( const key_type& k )
+			{
+				iterator	ite = this->lower_bound( k );
+
+				if ( ite != this->end() && !this->_comp( k , ite->first ) )
+					return ( pair< iterator , iterator >( ite , ite + 1 ) );
+				return ( pair< iterator , iterator >( ite , ite ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	 Allocator												 	  */
+			/* -------------------------------------------------------------- */
+
+			//  get_allocator() : returns a copy of allocator object associated with the container  //
+			allocator_type	get_allocator( void ) const
+			{
+				return ( this->_data.get_allocator() );
+			}
+
+		private :
+
+			/* -------------------------------------------------------------- */
+			/* 	 Search and sort											  */
+			/* -------------------------------------------------------------- */
+
+			//  lower_index() : index of first element whose key does not go before k  //
+			size_type	lower_index( const key_type& k ) const
+			{
+				size_type	low = 0;
+				size_type	high = this->_data.size();
+				size_type	middle;
+
+				while ( low < high )
+				{
+					middle = ( low + high ) / 2;
+					if ( this->_comp( this->_data[ middle ].first , k ) )
+						low = middle + 1;
+					else
+						high = middle;
+				}
+				return ( low );
+			}
+
+			//  upper_index() : index of first element whose key goes after k  //
+			size_type	upper_index( const key_type& k ) const
+			{
+				size_type	low = 0;
+				size_type	high = this->_data.size();
+				size_type	middle;
+
+				while ( low < high )
+				{
+					middle = ( low + high ) / 2;
+					if ( this->_comp( k , this->_data[ middle ].first ) )
+						high = middle;
+					else
+						low = middle + 1;
+				}
+				return ( low );
+			}
+
+			//  is_sorted_unique() : true if elements from index first are strictly increasing  //
+			bool	is_sorted_unique( size_type first ) const
+			{
+				for ( size_type i = first + 1 ; i < this->_data.size() ; ++i )
+				{
+					if ( !this->_comp( this->_data[ i - 1 ].first , this->_data[ i ].first ) )
+						return ( false );
+				}
+				return ( true );
+			}
+
+			//  sort_range() : stable merge sort of elements [first, last[ through a buffer of half their size  //
+			void	sort_range( size_type first , size_type last )
+			{
+				container_type	buffer( this->_data.begin() + first , this->_data.begin() + first + ( last - first + 1 ) / 2 );
+
+				this->merge_sort( &this->_data[ 0 ] + first , &this->_data[ 0 ] + last , &buffer[ 0 ] );
+				return ;
+			}
+
+			//  merge_sort() : sorts [first, last[ by key, equal keys keep their order  //
+			void	merge_sort( value_type* first , value_type* last , value_type* buffer )
+			{
+				value_type*	middle;
+
+				if ( last - first <= 16 )
+				{
+					this->insertion_sort( first , last );
+					return ;
+				}
+				middle = first + ( last - first ) / 2;
+				this->merge_sort( first , middle , buffer );
+				this->merge_sort( middle , last , buffer );
+				if ( this->_comp( middle->first , ( middle - 1 )->first ) )
+					this->merge( first , middle , last , buffer );
+				return ;
+			}
+
+			//  insertion_sort() : sorts a short [first, last[ by key, equal keys keep their order  //
+			void	insertion_sort( value_type* first , value_type* last )
+			{
+				for ( value_type* i = first + 1 ; i < last ; ++i )
+				{
+					if ( !this->_comp( i->first , ( i - 1 )->first ) )
+						continue ;
+					value_type	tmp( *i );
+					value_type*	j = i;
+
+					for ( ; j > first && this->_comp( tmp.first , ( j - 1 )->first ) ; --j )
+						*j = *( j - 1 );
+					*j = tmp;
+				}
+				return ;
+			}
+
+			//  merge() : merges sorted [first, middle[ and [middle, last[, the left run is copied to buffer first  //
+			void	merge( value_type* first , value_type* middle , value_type* last , value_type* buffer )
+			{
+				value_type*	left = buffer;
+				value_type*	left_end = buffer;
+
+				for ( value_type* i = first ; i < middle ; ++i )
+					*left_end++ = *i;
+				while ( left < left_end && middle < last )
+				{
+					if ( this->_comp( middle->first , left->first ) )
+						*first++ = *middle++;
+					else
+						*first++ = *left++;
+				}
+				while ( left < left_end )
+					*first++ = *left++;
+				return ;
+			}
+
+			//  merge_range() : merges the sorted elements [0, old_size[ and [old_size, size[, older first on equal keys  //
+			void	merge_range( size_type old_size )
+			{
+				container_type	merged( this->_data.get_allocator() );
+				size_type		i = 0;
+				size_type		j = old_size;
+
+				merged.reserve( this->_data.size() );
+				while ( i < old_size && j < this->_data.size() )
+				{
+					if ( this->_comp( this->_data[ j ].first , this->_data[ i ].first ) )
+						merged.push_back( this->_data[ j++ ] );
+					else
+						merged.push_back( this->_data[ i++ ] );
+				}
+				while ( i < old_size )
+					merged.push_back( this->_data[ i++ ] );
+				while ( j < this->_data.size() )
+					merged.push_back( this->_data[ j++ ] );
+				this->_data.swap( merged );
+				return ;
+			}
+
+			//  unique() : keeps the first element of every run of equal keys in sorted elements  //
+			void	unique( void )
+			{
+				size_type	w = 1;
+
+				if ( this->_data.empty() )
+					return ;
+				for ( size_type r = 1 ; r < this->_data.size() ; ++r )
+				{
+					if ( this->_comp( this->_data[ w - 1 ].first , this->_data[ r ].first ) )
+					{
+						if ( w != r )
+							this->_data[ w ] = this->_data[ r ];
+						++w;
+					}
+				}
+				if ( w != this->_data.size() )
+					this->_data.erase( this->_data.begin() + w , this->_data.end() );
+				return ;
+			}
+
+	}; /* class flat_map */
+
+	/* -------------------------------------------------------------------------*/
+	/*																			*/
+	/* 			 NON-MEMBER FUNCTIONS OVERLOADS									*/
+	/*																			*/
+	/* -------------------------------------------------------------------------*/
+
+	//  (1) Operator ==  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator==( const flat_map< Key , T , Compare , Alloc >& lhs , const flat_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( lhs.size() == rhs.size() && ft::equal( lhs.begin() , lhs.end() , rhs.begin() ));
+	}
+
+	//  (2) Operator !=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator!=( const flat_map< Key , T , Compare , Alloc >& lhs, const flat_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs == rhs ) );
+	}
+
+	//  (3) Operator <  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator<( const flat_map< Key , T , Compare , Alloc >& lhs , const flat_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( ft::lexicographical_compare( lhs.begin(), lhs.end() , rhs.begin() , rhs.end() ));
+	}
+
+	//  (4) Operator <=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator<=( const flat_map< Key , T , Compare , Alloc >& lhs , const flat_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( rhs < lhs ));
+	}
+
+	//  (5) Operator >  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator>( const flat_map< Key , T , Compare , Alloc >& lhs , const flat_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( rhs < lhs );
+	}
+
+	//  (6) Operator >=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator>=( const flat_map< Key , T , Compare , Alloc >& lhs , const flat_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs < rhs ) );
+	}
+
+	//  swap() : exchanges x content by y's ( same type )  //
+	template< class Key , class T , class Compare , class Alloc >
+	void	swap( flat_map< Key , T , Compare , Alloc >& x , flat_map< Key , T , Compare , Alloc >& y )
+	{
+		x.swap( y );
+		return ;
+	}
+
+} /* namespace ft */
+
+#endif /* FLAT_MAP_HPP */
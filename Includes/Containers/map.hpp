@@ -6,7 +6,7 @@
 /*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2022/11/07 11:25:55 by acaillea          #+#    #+#             */
-/*   Updated: 2023/02/02 19:29:11 by I-lan            ###   ########.fr       */
+/*   Updated: 2026/10/18 14:05:12 by I-lan            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,8 +19,10 @@
 
 # include "../Utils/algorithm.hpp"
 # include "../Utils/utility.hpp"
+# include "../Utils/type_traits.hpp"
 # include "../Utils/binary_search_tree.hpp"
 # include "../Utils/iterator.hpp"
+# include "../Utils/merge_iterator.hpp"
 
 /*
 
@@ -35,6 +37,10 @@ member type value_type, which is a pair type.
 nternally, the elements in a map are always sorted by its key following a 
 specific strict weak ordering criterion indicated by its internal comparison 
 object (of type Compare).
+The tree node type is a last template parameter ( see binary_search_tree.hpp ) : 
+an augmented node ( aggregate_node ) turns this map into the private base 
+of aggregate_map, its iterator_value telling whether iterators may write 
+mapped values.
 
 Unless otherwise indicated all refs come from :
 	https://cplusplus.com/reference/map/map/?kw=map
@@ -43,7 +49,10 @@ Unless otherwise indicated all refs come from :
 
 namespace ft
 {
-	template< class Key , class T , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > >
+	template< class Key , class T , class Monoid , class Compare , class Allocator >
+	class aggregate_map;
+
+	template< class Key , class T , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > , class Node = node< const Key , T > >
 	class map
 	{
 		public :
@@ -63,15 +72,17 @@ namespace ft
 			typedef typename allocator_type::const_reference					const_reference;
 			typedef typename allocator_type::pointer							pointer;
 			typedef typename allocator_type::const_pointer						const_pointer;
-			typedef typename ft::map_iterator< ft::pair< const Key , T > >		iterator;
+			typedef typename ft::map_iterator< typename Node::iterator_value >	iterator;
 			typedef typename ft::map_iterator< const ft::pair< const Key , T > > const_iterator;
 			typedef typename ft::reverse_iterator< iterator >					reverse_iterator;
 			typedef typename ft::reverse_iterator< const_iterator >				const_reverse_iterator;
 			typedef typename ft::iterator_traits< iterator >::difference_type	difference_type;
 			typedef typename allocator_type::size_type							size_type;
-			typedef tree< const Key , T , key_compare , allocator_type >		data_tree;
-			typedef node< const Key , T >*										nodePtr;
-			typedef std::allocator< node< key_type , mapped_type > >			nodeAlloc;
+			typedef Node														node_type;
+			typedef tree< const Key , T , key_compare , allocator_type , Node >	data_tree;
+			typedef node_type*													nodePtr;
+			typedef typename data_tree::basePtr									basePtr;
+			typedef typename data_tree::nodeAlloc								nodeAlloc;
 		
 		/* -------------------------------------------------------------------*/
 		/*																	  */
@@ -85,6 +96,10 @@ namespace ft
 			Compare		_comp;		// map::key_compare
 			data_tree	_tree;		// used search tree
 
+			//  aggregate_map reaches the tree to pull caches, its map base stays private  //
+			template< class K , class M , class Mo , class C , class A >
+			friend class aggregate_map;
+
 		public :
 		
 		/* -------------------------------------------------------------------*/
@@ -99,28 +114,33 @@ namespace ft
 			
 			//  (1) Default Constructor  //
 			explicit map( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() ) : \
-					_alloc( alloc ) , _comp( comp ) , _tree()
+					_alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
 			{
 				return ;
 			}
 
-			//  (2) Range Constructor  //
+			//  (2) Range Constructor : sorted input is built in O(n)  //
 			template< class InputIterator >
 			map( InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) 
-				: _alloc( alloc ) , _comp( comp ) , _tree()
+				: _alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
 			{
-				while ( first != last )
-				{
-					this->insert( *first );
-					first++;
-				}
+				this->_tree.build_sorted( first , last , false );
+				return ;
+			}
+
+			//  (2 bis) Sorted Range Constructor : [first, last[ must be sorted by key without duplicates, built in O(n) without comparison  //
+			template< class InputIterator >
+			map( sorted_unique_t , InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) 
+				: _alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
+			{
+				this->_tree.build_sorted( first , last , true );
 				return ;
 			}
 
-			//  (3) Copy Constructor  //
-			map( const map& x ) : _alloc( x._alloc ) , _comp( x._comp ) , _tree()
+			//  (3) Copy Constructor : node-for-node copy of x tree, O(n) without comparison  //
+			map( const map& x ) : _alloc( x._alloc ) , _comp( x._comp ) , _tree( x._comp , x._alloc )
 			{
-				this->insert( x.begin() , x.end() );
+				this->_tree.assign( x._tree );
 				return ;
 			}
 
@@ -138,11 +158,14 @@ namespace ft
 			/* 	Operator '=' overload										  */
 			/* -------------------------------------------------------------- */
 			
+			//  Node-for-node copy of x tree, reusing the nodes this map already holds  //
 			map& operator=( const map& x )
 			{
-
-				this->clear();
-				this->insert( x.begin() , x.end() );
+				if ( this != &x )
+				{
+					this->_comp = x._comp;
+					this->_tree.assign( x._tree );
+				}
 				return ( *this );
 			}
 
@@ -150,7 +173,7 @@ namespace ft
 			/* 	Iterators					 								  */
 			/* -------------------------------------------------------------- */
 
-			//  (1) begin : returns iterator pointing to the first element  //
+			//  (1) begin : returns iterator pointing to the first element (cached by the tree header)  //
 			iterator begin( void )
 			{
 				iterator	ite( this->_tree.begin() );
@@ -164,17 +187,17 @@ namespace ft
 				return ( cst_ite );
 			}
 
-			//  (1) end : returns iterator referring to the past-the-end element  //
+			//  (1) end : returns iterator referring to the past-the-end element (the tree header)  //
 			iterator end( void )
 			{
-				iterator	ite( NULL , this->_tree.end() );
+				iterator	ite( this->_tree.end() );
 				return ( ite );
 			}
 
 			//  (2) const end : returns const iterator referring to the past-the-end element  //
 			const_iterator end( void ) const
 			{
-				const_iterator	cst_ite( NULL , this->_tree.end() );
+				const_iterator	cst_ite( this->_tree.end() );
 				return ( cst_ite );
 			}
 
@@ -202,7 +225,7 @@ namespace ft
 			//  (2) const rend : returns reverse iterator pointing to theoretical element preceding the first element  //
 			const_reverse_iterator rend( void ) const
 			{
-				const_reverse_iterator	cst_rvrs_ite( this->end() );
+				const_reverse_iterator	cst_rvrs_ite( this->begin() );
 				return ( cst_rvrs_ite );
 			}
 
@@ -219,18 +242,7 @@ namespace ft
 			//  size() : returns the number of elements in map container  //
 			size_type size( void ) const
 			{
-				size_type	i = 1;
-				iterator	bg_ite( this->_tree.begin() );
-				iterator	end_ite( this->_tree.end() );
-
-				if ( this->_tree._root == NULL )
-					return ( 0 );
-				while ( bg_ite != end_ite )
-				{
-					bg_ite++;
-					i++;
-				}
-				return ( i );
+				return ( this->_tree.size() );
 			}
 
 			//  maxe_size() : returns maximum number of elements that map container can hold  //
@@ -244,14 +256,16 @@ namespace ft
 			/* -------------------------------------------------------------- */
 
 			//  Operator[] : if k matches the key of an element in map, the function returns reference to its mapped value  //
+			//  Single descent : mapped value is only default-constructed when k is missing  //
 			mapped_type& operator[]( const key_type& k )
 			{
-				nodePtr	tmp = this->_tree._root;
+				basePtr	parent;
+				bool	right;
+				basePtr	found = this->_tree.insert_position( k , parent , right );
 
-				if ( !tmp )
-					this->_tree._root = NULL;
-				ft::pair< iterator , bool >	new_node = this->insert( ft::make_pair( k , mapped_type() ));
-				return ( new_node.first->second );
+				if ( !found )
+					found = this->_tree.insert_at( parent , right , value_type( k , mapped_type() ) );
+				return ( static_cast< nodePtr >( found )->couple.second );
 			}
 
 			/* -------------------------------------------------------------- */
@@ -261,45 +275,42 @@ namespace ft
 			//  (1) single insert() : extends container by inserting a single new element increasing size by one  //
 			pair< iterator , bool >	insert( const value_type& val )
 			{
-				iterator 	ite( this->find( val.first ) );
-				bool 		ret = true;
-				
-				if ( ite == this->end() )
-				{
-					this->_tree.insert( val );
-					iterator ret_it( this->find( val.first ));
-					return ( pair< iterator , bool >( ret_it , ret ));	
-				}
-				else
-					ret = false;
-				return ( pair< iterator , bool >( ite , ret ));					
+				ft::pair< basePtr , bool >	ret = this->_tree.insert( val );
+
+				return ( pair< iterator , bool >( iterator( ret.first ) , ret.second ));
 			}
 
 			//  (2) with hint insert() : inserts val in position as close as possible to position just prior to pos  //
+			//  Amortized O(1) when val goes right before or right after position, plain insert otherwise  //
 			iterator	insert( iterator position , const value_type& val )
 			{
-				(void)position;
-				ft::pair< iterator , bool>	tmp = this->insert( val );
-				
-				return ( tmp.first );
+				return ( iterator( this->_tree.insert_hint( position._current , val ).first ) );
 			}
 
 			//  (3) range insert() : inserts elements from range [first, last[  //
+			//  Hinted at end() : sorted input is appended after the biggest node without a full descent  //
+			//  An empty map is bulk built instead  //
 			template< class InputIterator >
 			void	insert( InputIterator first , InputIterator last )
 			{
+				if ( this->empty() )
+				{
+					this->_tree.build_sorted( first , last , false );
+					return ;
+				}
 				while ( first != last )
 				{
-					this->insert( *first );
+					this->_tree.insert_hint( this->_tree.end() , *first );
 					first++;
 				}
 				return ;
 			}
 
 			//  (1) erase() : removes from map container the element at position  //
+			//  Unlinks the node position points to, without searching its key again  //
 			void	erase( iterator position )
 			{
-				this->_tree.erase( ( *position ).first );
+				this->_tree.erase_node( position._current );
 				return ;
 			}
 
@@ -316,30 +327,35 @@ namespace ft
 			}
 
 			//  (3) erase() : removes from map container a range of elements [first,last[  //
+			//  first is advanced before its node is unlinked, k elements cost O(k + log n) ; [begin, end[ clears the map at once  //
 			void	erase( iterator first , iterator last )
 			{
+				if ( first == this->begin() && last == this->end() )
+				{
+					this->clear();
+					return ;
+				}
 				while ( first != last )
 				{
-					this->_tree.erase( ( *first ).first );
-					first++;
+					this->_tree.erase_node( ( first++ )._current );
 				}
 				return ;
 			}
 
 			//  swap() : exchanges container's content by the content of x, which is another map of same type (sizes may differ)  //
+			//  O(1), no element is copied or allocated : only tree links are exchanged  //
 			void	swap( map& x )
 			{
 				Allocator	tmp_alloc	= 	this->_alloc;
 				Compare		tmp_comp	= 	this->_comp;
-				data_tree	tmp_tree	=	this->_tree;
 
 				this->_alloc 	=	x._alloc;
 				this->_comp		=	x._comp;
-				this->_tree		=	x._tree;
 
 				x._alloc	=	tmp_alloc;
 				x._comp		=	tmp_comp;
-				x._tree		=	tmp_tree;
+
+				this->_tree.swap( x._tree );
 
 				return ;
 			}
@@ -347,14 +363,26 @@ namespace ft
 			//  clear() : removes all elements from the map container (which are destroyed)  //
 			void	clear( void )
 			{
-				if ( this->_tree._root )
-				{
-					this->_tree.delete_tree( this->_tree._root );
-					this->_tree._root = NULL;
-				}
+				this->_tree.clear();
 				return ;
 			}
 
+			//  split() : moves every element whose key does not go before k into out (cleared first), in O(log n)  //
+			//  Nodes are relinked, not copied : iterators to moved elements stay valid and now belong to out  //
+			//  Both maps keep the node pool slabs alive until the last of them releases it  //
+			void	split( const key_type& k , map& out )
+			{
+				this->_tree.split( k , out._tree );
+				return ;
+			}
+
+			//  join() : moves every element of x into this in O(log n), x is left empty  //
+			//  Keys of x must all go after (or all before) those of this : returns false and changes nothing otherwise  //
+			bool	join( map& x )
+			{
+				return ( this->_tree.join( x._tree ) );
+			}
+
 			/* -------------------------------------------------------------- */
 			/* 	Observers					 								  */
 			/* -------------------------------------------------------------- */
@@ -400,112 +428,160 @@ namespace ft
 			//  (1) find() : searches container for an element with a key = k and returns an iterator to it if found, otherwise it returns map::end  //
 			iterator	find( const key_type& k )
 			{
-				nodePtr tmp = this->_tree.search( k );
-				
-				if ( tmp )
-				{
-					iterator ite( tmp );
-					return ( ite );
-				}
-				iterator ite( NULL , this->_tree.end() );
+				iterator ite( this->_tree.search( k ) );
+
 				return ( ite );
 			}
 
 			//  (2) find() : same but const  //
 			const_iterator	find( const key_type& k ) const
 			{
-				nodePtr tmp = this->_tree.search( k );
+				const_iterator cst_ite( this->_tree.search( k ) );
 
-				if ( tmp )
-				{
-					const_iterator cst_ite( tmp );
-					return ( cst_ite );
-				}
-				const_iterator cst_ite( NULL , this->_tree.end() );
 				return ( cst_ite );
 			}
 
+			//  (3) find() : transparent version, enabled when Compare declares is_transparent : k is compared to keys as is  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , iterator >::type	find( const K& k )
+			{
+				return ( iterator( this->_tree.search( k ) ) );
+			}
+
+			//  (4) find() : transparent version but const  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , const_iterator >::type	find( const K& k ) const
+			{
+				return ( const_iterator( this->_tree.search( k ) ) );
+			}
+
 			//  count() : searches container for elements with a key = k and returns the number of matches  //
 			size_type	count( const key_type& k ) const
 			{
-				if ( !( this->_tree.search( k )) )
+				if ( this->_tree.search( k ) == this->_tree.end() )
 				{
 					return ( 0 );
 				}
 				return ( 1 );
 			}
 
-			//  (1) lower_bound() : returns an iterator pointing to the first element in container whose key is not considered to go before k (= or after)  //
-			iterator	lower_bound( const key_type& k )
+			//  (2) count() : transparent version  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , size_type >::type	count( const K& k ) const
 			{
-				iterator	ite( this->_tree.begin() );
-				iterator	ite_end( NULL , this->_tree.end() );
-
-				while ( ite != ite_end )
+				if ( this->_tree.search( k ) == this->_tree.end() )
 				{
-					if ( !( this->_comp( (*ite).first , k )))
-						return ( ite );
-					ite++;
+					return ( 0 );
 				}
-				return ( ite_end );
+				return ( 1 );
+			}
+
+			//  (1) lower_bound() : returns an iterator pointing to the first element in container whose key is not considered to go before k (= or after)  //
+			iterator	lower_bound( const key_type& k )
+			{
+				return ( iterator( this->_tree.lower_bound( k ) ) );
 			}
 			
 			//  (2) lower_bound() : same but const  //
 			const_iterator	lower_bound( const key_type& k ) const
 			{
-				const_iterator	cst_ite( this->_tree.begin() );
-				const_iterator	cst_ite_end( NULL , this->_tree.end() );
+				return ( const_iterator( this->_tree.lower_bound( k ) ) );
+			}
 
-				while ( cst_ite != cst_ite_end )
-				{
-					if ( !( this->_comp( (*cst_ite).first , k )))
-						return ( cst_ite );
-					cst_ite++;
-				}
-				return ( cst_ite_end );
+			//  (3) lower_bound() : transparent version  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , iterator >::type	lower_bound( const K& k )
+			{
+				return ( iterator( this->_tree.lower_bound( k ) ) );
+			}
+
+			//  (4) lower_bound() : transparent version but const  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , const_iterator >::type	lower_bound( const K& k ) const
+			{
+				return ( const_iterator( this->_tree.lower_bound( k ) ) );
 			}
 
 			//  (1) upper_bound : returns an iterator pointing to the first element in container whose key go after k  //
 			iterator	upper_bound( const key_type& k )
 			{
-				iterator	ite( this->_tree.begin() );
-				iterator	ite_end( NULL , this->_tree.end() );
-
-				while ( ite != ite_end )
-				{
-					if ( this->_comp( k, (*ite).first ))
-						return ( ite );
-					ite++;
-				}
-				return ( ite_end );
+				return ( iterator( this->_tree.upper_bound( k ) ) );
 			}
 
-
 			//  (2) upper_bound : same but const  //
 			const_iterator	upper_bound( const key_type& k ) const
 			{
-				const_iterator	cst_ite( this->_tree.begin() );
-				const_iterator	cst_ite_end( NULL , this->_tree.end() );
+				return ( const_iterator( this->_tree.upper_bound( k ) ) );
+			}
 
-				while ( cst_ite != cst_ite_end )
-				{
-					if ( this->_comp( k, (*cst_ite).first ))
-						return ( cst_ite );
-					cst_ite++;
-				}
-				return ( cst_ite_end );
+			//  (3) upper_bound : transparent version  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , iterator >::type	upper_bound( const K& k )
+			{
+				return ( iterator( this->_tree.upper_bound( k ) ) );
+			}
+
+			//  (4) upper_bound : transparent version but const  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , const_iterator >::type	upper_bound( const K& k ) const
+			{
+				return ( const_iterator( this->_tree.upper_bound( k ) ) );
 			}
 
 			//  (1) equal_range : returns the bounds of a range that includes all the elements in container which have a key = k  //
 			pair< const_iterator , const_iterator >	equal_range( const key_type& k ) const
 			{
-				return ( pair< const_iterator , const_iterator >( this->lower_bound( k ) , this->upper_bound( k )));
+				ft::pair< basePtr , basePtr >	bounds = this->_tree.equal_range( k );
+
+				return ( pair< const_iterator , const_iterator >( bounds.first , bounds.second ));
 			}
 		
 			//  (2) equal_range : same but not const  //
 			pair< iterator , iterator >	equal_range( const key_type& k )
 			{
-				return ( pair< iterator , iterator >( this->lower_bound( k ) , this->upper_bound( k )));
+				ft::pair< basePtr , basePtr >	bounds = this->_tree.equal_range( k );
+
+				return ( pair< iterator , iterator >( bounds.first , bounds.second ));
+			}
+
+			//  (3) equal_range : transparent version but const  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , pair< const_iterator , const_iterator > >::type	equal_range( const K& k ) const
+			{
+				ft::pair< basePtr , basePtr >	bounds = this->_tree.equal_range( k );
+
+				return ( pair< const_iterator , const_iterator >( bounds.first , bounds.second ));
+			}
+
+			//  (4) equal_range : transparent version  //
+			template< class K >
+			typename ft::enable_if< has_is_transparent< Compare , K >::value , pair< iterator , iterator > >::type	equal_range( const K& k )
+			{
+				ft::pair< basePtr , basePtr >	bounds = this->_tree.equal_range( k );
+
+				return ( pair< iterator , iterator >( bounds.first , bounds.second ));
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Order statistics			 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) nth() : returns an iterator to the element of index k in key order (end() if k >= size()), O(log n)  //
+			iterator	nth( size_type k )
+			{
+				return ( iterator( this->_tree.select( k ) ) );
+			}
+
+			//  (2) nth() : same but const  //
+			const_iterator	nth( size_type k ) const
+			{
+				return ( const_iterator( this->_tree.select( k ) ) );
+			}
+
+			//  rank() : returns the number of elements whose key goes before k (index of lower_bound( k )), O(log n)  //
+			size_type	rank( const key_type& k ) const
+			{
+				return ( this->_tree.rank( k ) );
 			}
 
 			/* -------------------------------------------------------------- */
@@ -526,48 +602,116 @@ namespace ft
 	/*																			*/
 	/* -------------------------------------------------------------------------*/
 
-	//  (1) Operator ==  //
-	template< class Key , class T , class Compare , class Alloc >
-	bool	operator==( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	//  (1) Operator == : size() is O(1), so maps of different sizes are told apart before any element compare  //
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	bool	operator==( const map< Key , T , Compare , Alloc , Node >& lhs , const map< Key , T , Compare , Alloc , Node >& rhs )
 	{
 		return ( lhs.size() == rhs.size() && ft::equal( lhs.begin() , lhs.end() , rhs.begin() ));
 	}
 
 	//  (2) Operator !=  //
-	template< class Key , class T , class Compare , class Alloc >
-	bool	operator!=( const map< Key , T , Compare , Alloc >& lhs, const map< Key , T , Compare , Alloc >& rhs )
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	bool	operator!=( const map< Key , T , Compare , Alloc , Node >& lhs, const map< Key , T , Compare , Alloc , Node >& rhs )
 	{
 		return ( !( lhs == rhs ) );
 	}
 
 	//  (3) Operator <  //
-	template< class Key , class T , class Compare , class Alloc >
-	bool	operator<( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	bool	operator<( const map< Key , T , Compare , Alloc , Node >& lhs , const map< Key , T , Compare , Alloc , Node >& rhs )
 	{
 		return ( ft::lexicographical_compare( lhs.begin(), lhs.end() , rhs.begin() , rhs.end() ));
 	}
 
 	//  (4) Operator <=  //
-	template< class Key , class T , class Compare , class Alloc >
-	bool	operator<=( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	bool	operator<=( const map< Key , T , Compare , Alloc , Node >& lhs , const map< Key , T , Compare , Alloc , Node >& rhs )
 	{
 		return ( !( rhs < lhs ));
 	}
 
 	//  (5) Operator >  //
-	template< class Key , class T , class Compare , class Alloc >
-	bool	operator>( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	bool	operator>( const map< Key , T , Compare , Alloc , Node >& lhs , const map< Key , T , Compare , Alloc , Node >& rhs )
 	{
 		return ( rhs < lhs );
 	}
 
 	//  (6) Operator >=  //
-	template< class Key , class T , class Compare , class Alloc >
-	bool	operator>=( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	bool	operator>=( const map< Key , T , Compare , Alloc , Node >& lhs , const map< Key , T , Compare , Alloc , Node >& rhs )
 	{
 		return ( !( lhs < rhs ) );
 	}
 
+	//  swap() : exchanges x content by y's ( same type )  //
+	template< class Key , class T , class Compare , class Alloc , class Node >
+	void	swap( map< Key , T , Compare , Alloc , Node >& x , map< Key , T , Compare , Alloc , Node >& y )
+	{
+		x.swap( y );
+		return ;
+	}
+
+	/* -------------------------------------------------------------------------*/
+	/*																			*/
+	/* 			 SET ALGEBRA													*/
+	/*																			*/
+	/* -------------------------------------------------------------------------*/
+
+	//  Both maps are walked in key order at once by a merge_iterator, whose output is  //
+	//  sorted and unique : the result is bulk built without a single lookup, in O(n + m)  //
+
+	//  merge_build() : builds a map from the Mode walk of lhs and rhs  //
+	template< class Mode , class Key , class T , class Compare , class Alloc >
+	map< Key , T , Compare , Alloc >	merge_build( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	{
+		typedef typename map< Key , T , Compare , Alloc >::const_iterator	const_iterator;
+		typedef merge_iterator< const_iterator , Compare , Mode >			merge_it;
+
+		return ( map< Key , T , Compare , Alloc >( sorted_unique , \
+			merge_it( lhs.begin() , lhs.end() , rhs.begin() , rhs.end() , lhs.key_comp() ) , \
+			merge_it( lhs.end() , lhs.end() , rhs.end() , rhs.end() , lhs.key_comp() ) , \
+			lhs.key_comp() , lhs.get_allocator() ) );
+	}
+
+	//  merge_union() : keys of lhs or rhs, lhs's value is kept when both hold a key  //
+	template< class Key , class T , class Compare , class Alloc >
+	map< Key , T , Compare , Alloc >	merge_union( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( merge_build< merge_union_tag >( lhs , rhs ) );
+	}
+
+	//  intersection() : keys of both lhs and rhs, with lhs's values  //
+	template< class Key , class T , class Compare , class Alloc >
+	map< Key , T , Compare , Alloc >	intersection( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( merge_build< merge_intersection_tag >( lhs , rhs ) );
+	}
+
+	//  difference() : keys of lhs that rhs does not hold  //
+	template< class Key , class T , class Compare , class Alloc >
+	map< Key , T , Compare , Alloc >	difference( const map< Key , T , Compare , Alloc >& lhs , const map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( merge_build< merge_difference_tag >( lhs , rhs ) );
+	}
+
+	//  diff() : reconciles two snapshots, T needs operator==  //
+	//  added : keys only in to , removed : keys only in from , changed : keys in both whose value differs, with to's value  //
+	//  The three outputs are replaced only once all of them are built  //
+	template< class Key , class T , class Compare , class Alloc >
+	void	diff( const map< Key , T , Compare , Alloc >& from , const map< Key , T , Compare , Alloc >& to , \
+		map< Key , T , Compare , Alloc >& added , map< Key , T , Compare , Alloc >& removed , map< Key , T , Compare , Alloc >& changed )
+	{
+		map< Key , T , Compare , Alloc >	new_added( merge_build< merge_difference_tag >( to , from ) );
+		map< Key , T , Compare , Alloc >	new_removed( merge_build< merge_difference_tag >( from , to ) );
+		map< Key , T , Compare , Alloc >	new_changed( merge_build< merge_changed_tag >( from , to ) );
+
+		added.swap( new_added );
+		removed.swap( new_removed );
+		changed.swap( new_changed );
+		return ;
+	}
+
 } /* namespace ft */
 
 #endif /* MAP_HPP */
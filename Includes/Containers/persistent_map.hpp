@@ -0,0 +1,514 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_map.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:47:05 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 18:41:22 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+
+# include "../Utils/algorithm.hpp"
+# include "../Utils/utility.hpp"
+# include "../Utils/persistent_tree.hpp"
+# include "../Utils/iterator.hpp"
+
+/*
+
+Persistent_map are associative containers with the interface of ft::map, 
+whose versions share their nodes ( see persistent_tree.hpp ) :
+	- snapshot(), the copy constructor and operator= are O(1) : the copy 
+	  is a frozen view of the map, later writes on either side do not show 
+	  on the other,
+	- a write copies only the nodes of its path still shared with a 
+	  snapshot, O(log n), nothing once the snapshot is dropped,
+	- a snapshot may be handed to another thread and read there while the 
+	  writer goes on, without any lock : shared nodes are never modified, 
+	  and reference counts are atomic.
+Iterators are constant, as elements may be shared ; operator[] copies the 
+path to its element first, the reference it returns is invalidated by the 
+next snapshot. Stateful allocators must compare equal between versions.
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/map/map/?kw=map
+	Making Data Structures Persistent (Driscoll, Sarnak, Sleator, Tarjan), 1989
+
+*/
+
+namespace ft
+{
+	template< class Key , class T , class Compare = std::less< Key > , class Allocator = std::allocator< pair< const Key , T > > >
+	class persistent_map
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef Key															key_type;
+			typedef T															mapped_type;
+			typedef ft::pair< const key_type , mapped_type >					value_type;
+			typedef Compare														key_compare;
+			typedef Allocator													allocator_type;
+			typedef typename allocator_type::reference							reference;
+			typedef typename allocator_type::const_reference					const_reference;
+			typedef typename allocator_type::pointer							pointer;
+			typedef typename allocator_type::const_pointer						const_pointer;
+			typedef persistent_tree< Key , T , key_compare , allocator_type >	data_tree;
+			typedef typename data_tree::const_iterator							iterator;
+			typedef typename data_tree::const_iterator							const_iterator;
+			typedef typename ft::reverse_iterator< iterator >					reverse_iterator;
+			typedef typename ft::reverse_iterator< const_iterator >				const_reverse_iterator;
+			typedef typename ft::iterator_traits< iterator >::difference_type	difference_type;
+			typedef typename allocator_type::size_type							size_type;
+			typedef typename data_tree::nodePtr									nodePtr;
+		
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 ATTRIBUTES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+		private :
+
+			Allocator	_alloc;		// allocator object
+			Compare		_comp;		// persistent_map::key_compare
+			data_tree	_tree;		// version of the shared tree
+
+		public :
+		
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  (1) Default Constructor  //
+			explicit persistent_map( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() ) : \
+					_alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
+			{
+				return ;
+			}
+
+			//  (2) Range Constructor  //
+			template< class InputIterator >
+			persistent_map( InputIterator first , InputIterator last , const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type() ) 
+				: _alloc( alloc ) , _comp( comp ) , _tree( comp , alloc )
+			{
+				this->insert( first , last );
+				return ;
+			}
+
+			//  (3) Copy Constructor : O(1), shares x nodes  //
+			persistent_map( const persistent_map& x ) : _alloc( x._alloc ) , _comp( x._comp ) , _tree( x._tree )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+			
+			//  Drops this version : only nodes no other version holds are destroyed  //
+			~persistent_map( void )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+			
+			//  O(1), shares x nodes and drops the current version  //
+			persistent_map& operator=( const persistent_map& x )
+			{
+				this->_comp = x._comp;
+				this->_tree = x._tree;
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Iterators					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) begin : returns iterator pointing to the first element  //
+			iterator begin( void )
+			{
+				return ( this->_tree.begin() );
+			}
+
+			//  (2) const begin : returns const iterator pointing to the first element  //	
+			const_iterator begin( void ) const
+			{
+				return ( this->_tree.begin() );
+			}
+
+			//  (1) end : returns iterator referring to the past-the-end element  //
+			iterator end( void )
+			{
+				return ( this->_tree.end() );
+			}
+
+			//  (2) const end : returns const iterator referring to the past-the-end element  //
+			const_iterator end( void ) const
+			{
+				return ( this->_tree.end() );
+			}
+
+			//  (1) rbegin : returns reverse iterator pointing the last element  //
+      		reverse_iterator rbegin( void )
+			{
+				reverse_iterator	rvrs_ite( this->end() );
+				return ( rvrs_ite );
+			}
+
+			//  (2) const rbegin : returns const reverse iterator pointing the last element  //
+			const_reverse_iterator rbegin( void ) const
+			{
+				const_reverse_iterator	cst_rvrs_ite( this->end() );
+				return ( cst_rvrs_ite );
+			}
+
+			//  (1) rend : returns reverse iterator pointing to theoretical element preceding the first element  //
+      		reverse_iterator rend( void )
+			{
+				reverse_iterator	rvrs_ite( this->begin() );
+				return ( rvrs_ite );
+			}
+
+			//  (2) const rend : returns reverse iterator pointing to theoretical element preceding the first element  //
+			const_reverse_iterator rend( void ) const
+			{
+				const_reverse_iterator	cst_rvrs_ite( this->begin() );
+				return ( cst_rvrs_ite );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Capacity					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : returns whether map container is empty (i.e. whether its size is 0) //
+			bool empty( void ) const
+			{
+				return ( this->_tree._size == 0 );
+			}
+
+			//  size() : returns the number of elements in map container  //
+			size_type size( void ) const
+			{
+				return ( this->_tree._size );
+			}
+
+			//  maxe_size() : returns maximum number of elements that map container can hold  //
+			size_type max_size( void ) const
+			{
+				return ( this->_alloc.max_size() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Element access				 								  */
+			/* -------------------------------------------------------------- */
+
+			//  operator[] : if k matches the key of an element, returns a reference to its mapped value, else inserts it  //
+			//  Nodes down to the element are copied first if shared : the reference is valid until the next snapshot  //
+			mapped_type&	operator[]( const key_type& k )
+			{
+				return ( this->_tree.own_node( k )->couple.second );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) single insert() : extends container by inserting a single new element increasing size by one  //
+			pair< iterator , bool >	insert( const value_type& val )
+			{
+				return ( this->_tree.insert( val ) );
+			}
+
+			//  (2) with hint insert() : the path is rebuilt from the root anyway, position is ignored  //
+			iterator	insert( iterator position , const value_type& val )
+			{
+				( void )position;
+				return ( this->insert( val ).first );
+			}
+
+			//  (3) range insert() : inserts elements from range [first, last[  //
+			template< class InputIterator >
+			void	insert( InputIterator first , InputIterator last )
+			{
+				while ( first != last )
+				{
+					this->_tree.insert( *first );
+					first++;
+				}
+				return ;
+			}
+
+			//  (1) erase() : removes from map container the element at position  //
+			//  The key is copied first : the node holding it may be destroyed on the way  //
+			void	erase( iterator position )
+			{
+				key_type	k( position->first );
+
+				this->_tree.erase( k );
+				return ;
+			}
+
+			//  (2) erase() : removes from map container the element (if) with the key equivalent to k  //
+			size_type	erase( const key_type& k )
+			{
+				size_type	ret = 0;
+
+				if ( this->_tree.erase( k ) )
+				{
+					ret = 1;
+				}
+				return ( ret );
+			}
+
+			//  (3) erase() : removes from map container a range of elements [first,last[  //
+			//  Erasing moves nodes, so iterators do not survive it : once first key is gone, lower_bound( first key ) is the next one  //
+			void	erase( iterator first , iterator last )
+			{
+				size_type	n = 0;
+
+				if ( first == this->begin() && last == this->end() )
+				{
+					this->clear();
+					return ;
+				}
+				for ( iterator it = first ; it != last ; ++it )
+					++n;
+				if ( !n )
+					return ;
+				key_type	k( first->first );
+
+				while ( n-- )
+				{
+					this->erase( this->lower_bound( k ) );
+				}
+				return ;
+			}
+
+			//  swap() : exchanges container's content by the content of x, which is another map of same type (sizes may differ)  //
+			//  O(1), no element is copied or allocated : only roots are exchanged  //
+			void	swap( persistent_map& x )
+			{
+				Allocator	tmp_alloc	= 	this->_alloc;
+				Compare		tmp_comp	= 	this->_comp;
+
+				this->_alloc 	=	x._alloc;
+				this->_comp		=	x._comp;
+
+				x._alloc	=	tmp_alloc;
+				x._comp		=	tmp_comp;
+
+				this->_tree.swap( x._tree );
+
+				return ;
+			}
+
+			//  clear() : removes all elements from the map container, nodes still held by a snapshot stay alive  //
+			void	clear( void )
+			{
+				this->_tree.clear();
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Snapshots					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  snapshot() : returns a frozen view of the map, O(1) ; reading it needs no lock, whatever the map does next  //
+			persistent_map	snapshot( void ) const
+			{
+				return ( persistent_map( *this ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Observers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  key_comp() : returns a copy of the container's comparison object to compare keys //
+			key_compare	key_comp( void ) const
+			{
+				return ( this->_comp );
+			}
+
+			//  class value_compare : nested class that uses internal comparison object to generate appropriate comparison functional class  //
+			//  Ref : https://cplusplus.com/reference/map/map/value_comp/  //
+			class value_compare
+			{
+				friend class persistent_map;
+				
+				protected :
+	
+					Compare	comp;
+					value_compare( Compare c ) : comp( c ) {}
+
+				public :
+
+					typedef bool		result_type;
+					typedef value_type 	first_argument_type;
+					typedef value_type 	second_argument_type;
+					bool operator()( const value_type& x , const value_type& y ) const
+					{
+						return ( comp( x.first , y.first ) );
+					}
+			};
+
+			//  value_comp() : returns a comparison object that can be used to compare two elements to get whether the key of the first one goes before the second  //
+			value_compare	value_comp( void ) const
+			{
+				return ( value_compare( _comp) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operations					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) find() : searches container for an element with a key = k and returns an iterator to it if found, otherwise it returns map::end  //
+			iterator	find( const key_type& k )
+			{
+				return ( this->_tree.find( k ) );
+			}
+
+			//  (2) find() : same but const  //
+			const_iterator	find( const key_type& k ) const
+			{
+				return ( this->_tree.find( k ) );
+			}
+
+			//  count() : searches container for elements with a key = k and returns the number of matches  //
+			size_type	count( const key_type& k ) const
+			{
+				if ( !this->_tree.find_node( k ) )
+				{
+					return ( 0 );
+				}
+				return ( 1 );
+			}
+
+			//  (1) lower_bound() : returns an iterator pointing to the first element in container whose key is not considered to go before k (= or after)  //
+			iterator	lower_bound( const key_type& k )
+			{
+				return ( this->_tree.lower_bound( k ) );
+			}
+			
+			//  (2) lower_bound() : same but const  //
+			const_iterator	lower_bound( const key_type& k ) const
+			{
+				return ( this->_tree.lower_bound( k ) );
+			}
+
+			//  (1) upper_bound : returns an iterator pointing to the first element in container whose key go after k  //
+			iterator	upper_bound( const key_type& k )
+			{
+				return ( this->_tree.upper_bound( k ) );
+			}
+
+			//  (2) upper_bound : same but const  //
+			const_iterator	upper_bound( const key_type& k ) const
+			{
+				return ( this->_tree.upper_bound( k ) );
+			}
+
+			//  (1) equal_range : returns the bounds of a range that includes all the elements in container which have a key = k  //
+			pair< const_iterator , const_iterator >	equal_range( const key_type& k ) const
+			{
+				return ( pair< const_iterator , const_iterator >( this->lower_bound( k ) , this->upper_bound( k ) ));
+			}
+		
+			//  (2) equal_range : same but not const  //
+			pair< iterator , iterator >	equal_range( const key_type& k )
+			{
+				return ( pair< iterator , iterator >( this->lower_bound( k ) , this->upper_bound( k ) ));
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	 Allocator												 	  */
+			/* -------------------------------------------------------------- */
+
+			//  get_allocator() : returns a copy of allocator object associated with the map  //
+			allocator_type	get_allocator( void ) const
+			{
+				return ( this->_alloc );
+			}
+
+	}; /* class persistent_map */
+
+	/* -------------------------------------------------------------------------*/
+	/*																			*/
+	/* 			 NON-MEMBER FUNCTIONS OVERLOADS									*/
+	/*																			*/
+	/* -------------------------------------------------------------------------*/
+
+	//  (1) Operator == : size() is O(1), so maps of different sizes are told apart before any element compare  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator==( const persistent_map< Key , T , Compare , Alloc >& lhs , const persistent_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( lhs.size() == rhs.size() && ft::equal( lhs.begin() , lhs.end() , rhs.begin() ));
+	}
+
+	//  (2) Operator !=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator!=( const persistent_map< Key , T , Compare , Alloc >& lhs, const persistent_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs == rhs ) );
+	}
+
+	//  (3) Operator <  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator<( const persistent_map< Key , T , Compare , Alloc >& lhs , const persistent_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( ft::lexicographical_compare( lhs.begin(), lhs.end() , rhs.begin() , rhs.end() ));
+	}
+
+	//  (4) Operator <=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator<=( const persistent_map< Key , T , Compare , Alloc >& lhs , const persistent_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( rhs < lhs ));
+	}
+
+	//  (5) Operator >  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator>( const persistent_map< Key , T , Compare , Alloc >& lhs , const persistent_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( rhs < lhs );
+	}
+
+	//  (6) Operator >=  //
+	template< class Key , class T , class Compare , class Alloc >
+	bool	operator>=( const persistent_map< Key , T , Compare , Alloc >& lhs , const persistent_map< Key , T , Compare , Alloc >& rhs )
+	{
+		return ( !( lhs < rhs ) );
+	}
+
+	//  swap() : exchanges x content by y's ( same type )  //
+	template< class Key , class T , class Compare , class Alloc >
+	void	swap( persistent_map< Key , T , Compare , Alloc >& x , persistent_map< Key , T , Compare , Alloc >& y )
+	{
+		x.swap( y );
+		return ;
+	}
+
+} /* namespace ft */
+
+#endif /* PERSISTENT_MAP_HPP */
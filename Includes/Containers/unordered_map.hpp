@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unordered_map.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:37:54 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 19:04:55 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef UNORDERED_MAP_HPP
+# define UNORDERED_MAP_HPP
+
+# include <cstddef>
+# include <memory>
+# include <functional>
+
+# include "../Utils/utility.hpp"
+# include "../Utils/hash.hpp"
+# include "../Utils/hash_map_base.hpp"
+# include "../Utils/robin_hood_table.hpp"
+
+/*
+
+Unordered_map are associative containers storing elements formed by the 
+combination of a key value and a mapped value, without order, found by the 
+hash of their key ( see robin_hood_table.hpp ) :
+	- elements are stored inline in one flat array, no node per element,
+	- a lookup hashes once and reads a few neighbouring slots, O(1) on 
+	  average,
+	- the table grows by doubling when size() would go over 
+	  max_load_factor() * bucket_count().
+Inserts and erases move elements within the array : unlike ft::map they 
+invalidate iterators and references ( erase( position ) returns the next 
+valid iterator ).
+Everything but erasing at iterators and the hash policy is shared with 
+the other hash maps ( see hash_map_base.hpp ).
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/unordered_map/unordered_map/
+
+*/
+
+namespace ft
+{
+	template< class Key , class T , class Hash = ft::hash< Key > , class KeyEqual = std::equal_to< Key > , \
+			class Allocator = std::allocator< pair< const Key , T > > >
+	class unordered_map : public hash_map_base< robin_hood_table< Key , T , Hash , KeyEqual , Allocator > >
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef hash_map_base< robin_hood_table< Key , T , Hash , KeyEqual , Allocator > >	base_type;
+			typedef typename base_type::value_type								value_type;
+			typedef typename base_type::hasher									hasher;
+			typedef typename base_type::key_equal								key_equal;
+			typedef typename base_type::allocator_type							allocator_type;
+			typedef typename base_type::data_table								data_table;
+			typedef typename base_type::iterator								iterator;
+			typedef typename base_type::const_iterator							const_iterator;
+			typedef typename base_type::size_type								size_type;
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) Default Constructor : room for n elements without growing  //
+			explicit unordered_map( size_type n = 0 , const hasher& hf = hasher() , const key_equal& eq = key_equal() , \
+					const allocator_type& alloc = allocator_type() ) : base_type( n , hf , eq , alloc )
+			{
+				return ;
+			}
+
+			//  (2) Range Constructor  //
+			template< class InputIterator >
+			unordered_map( InputIterator first , InputIterator last , size_type n = 0 , const hasher& hf = hasher() , \
+					const key_equal& eq = key_equal() , const allocator_type& alloc = allocator_type() ) : base_type( n , hf , eq , alloc )
+			{
+				this->insert( first , last );
+				return ;
+			}
+
+			//  (3) Copy Constructor : slot for slot copy, no hashing  //
+			unordered_map( const unordered_map& x ) : base_type( x )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+
+			~unordered_map( void )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+
+			unordered_map& operator=( const unordered_map& x )
+			{
+				base_type::operator=( x );
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (2) erase( k ) is hash_map_base's  //
+			using base_type::erase;
+
+			//  (1) erase() : removes the element at position, returns an iterator to the element that followed it  //
+			//  The elements behind come back one slot : the next one may now be at position  //
+			iterator	erase( const_iterator position )
+			{
+				size_type	i = position._dist - this->_table._dist;
+
+				this->_table.erase_slot( i );
+				return ( this->_table.at( i ).skip() );
+			}
+
+			//  (3) erase() : removes a range of elements [first,last[  //
+			//  Erasing shifts the elements after, last may move : the range is counted first, then erased one by one  //
+			iterator	erase( const_iterator first , const_iterator last )
+			{
+				size_type	n = 0;
+				iterator	ret( const_cast< value_type* >( first._slot ) , first._dist );
+
+				for ( const_iterator it = first ; it != last ; ++it )
+					++n;
+				while ( n-- )
+					ret = this->erase( ret );
+				return ( ret );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Hash policy					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  bucket_count() : home slots, a power of two ; overflow slots come on top  //
+			size_type	bucket_count( void ) const
+			{
+				return ( this->_table._homes );
+			}
+
+			//  load_factor() : size() / bucket_count()  //
+			float	load_factor( void ) const
+			{
+				return ( this->_table._homes ? static_cast< float >( this->_table._size ) / this->_table._homes : 0.0f );
+			}
+
+			//  (1) max_load_factor() : load factor the table grows at, 0.8 by default  //
+			float	max_load_factor( void ) const
+			{
+				return ( this->_table._max_load );
+			}
+
+			//  (2) max_load_factor() : sets it, throws invalid_argument unless positive ; robin hood probes stay short up to about 0.9  //
+			void	max_load_factor( float ml )
+			{
+				this->_table.max_load_factor( ml );
+				return ;
+			}
+
+			//  rehash() : at least n buckets, and enough for size()  //
+			void	rehash( size_type n )
+			{
+				this->_table.rehash( n );
+				return ;
+			}
+
+			//  reserve() : room for n elements without growing  //
+			void	reserve( size_type n )
+			{
+				this->_table.rehash( this->_table.homes_for( n ) );
+				return ;
+			}
+
+	}; /* class unordered_map */
+
+	//  Comparisons and swap() are hash_map_base's, found through the base class  //
+
+} /* namespace ft */
+
+#endif /* UNORDERED_MAP_HPP */
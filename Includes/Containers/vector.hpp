@@ -155,7 +155,7 @@ namespace ft
 	
 			vector&	operator=( const vector& x )
 			{
-				if ( *this != x )
+				if ( this != &x )
 				{
 					this->assign( x.begin() , x.end() );
 				}
@@ -483,11 +483,21 @@ namespace ft
 				}
 				else
 				{
-					for ( ssize_t i = this->_size - 1 ; i >= static_cast< ssize_t >( pos ) ; i-- )
-						this->_start[ i + n ] = this->_start[ i ];
+					for ( size_type i = this->_size ; i-- > pos ; )
+					{
+						if ( i + n >= this->_size )
+							this->_alloc.construct( this->_start + i + n , this->_start[ i ] );
+						else
+							this->_start[ i + n ] = this->_start[ i ];
+					}
 
 					for ( size_type i = pos ; i < ( pos + n ); i++ )
-						this->_alloc.construct( this->_start + i , val );
+					{
+						if ( i < this->_size )
+							this->_start[ i ] = val;
+						else
+							this->_alloc.construct( this->_start + i , val );
+					}
 				}
 				this->_size += n;
 				return ;
@@ -537,62 +547,51 @@ namespace ft
 				}
 				else
 				{
-					for ( ssize_t i = this->_size - 1 ; i >= static_cast< ssize_t >( pos ) ; i-- )
-						this->_start[ i + dist ] = this->_start[ i ];
+					for ( size_type i = this->_size ; i-- > pos ; )
+					{
+						if ( i + dist >= this->_size )
+							this->_alloc.construct( this->_start + i + dist , this->_start[ i ] );
+						else
+							this->_start[ i + dist ] = this->_start[ i ];
+					}
 
-					for ( size_type i = pos ; i < ( pos + dist ); i++ )
-						this->_alloc.construct( this->_start + i , *first++ );
+					for ( size_type i = pos ; i < ( pos + dist ); i++ , first++ )
+					{
+						if ( i < this->_size )
+							this->_start[ i ] = *first;
+						else
+							this->_alloc.construct( this->_start + i , *first );
+					}
 				}
 				this->_size += dist;
 				return ;
 			}
 
 			//  (1) erase() position version : removes specific vector element  //
+			//  Following elements are shifted down by assignment, only the last one is destroyed  //
 			iterator	erase( iterator position )
 			{
-				iterator	tmp  = position;
-				iterator	iter = this->_start;
-				size_type	i	 = 0;
-
-				while ( iter != position )
-				{
-					iter++;
-					i++;
-				}
-				this->_alloc.destroy( this->_start + i );
-				while ( position + 1 < this->end() )
-				{
-					*position = *( position + 1 );
-					position++;
-				}
-				this->_size--;
-				return ( tmp );
+				return ( this->erase( position , position + 1 ) );
 			}
 
 			//  (2) erase() ranger version : removes elements btw [first & last[  //
+			//  Following elements are shifted down by assignment, only the dist last ones are destroyed  //
 			iterator	erase( iterator first , iterator last )
 			{
-				iterator	iter	= this->_start;
-				iterator	ret		= first;
+				iterator	iter	= first;
 				size_type	dist	= ft::distance( first , last );
-				size_type	i 		= 0;
-				
-				while ( iter != first )
-				{
-					*iter++;
-					i++;
-				}
-				for ( ; i < dist ; i++ )
-				{
-					this->_alloc.destroy( this->_start + i );
-				}
+
 				while ( iter + dist < this->end() )
 				{
 					*iter = *( iter + dist );
 					iter++;	
 				}
+				for ( size_type i = this->_size - dist ; i < this->_size ; i++ )
+				{
+					this->_alloc.destroy( this->_start + i );
+				}
 				this->_size -= dist;
-				return ( ret );
+				return ( first );
 			}
 
 			//  swap() : exchanges current content by x content  //
@@ -649,7 +648,7 @@ namespace ft
 	template < class T	, class Alloc >
 	bool operator==( const vector< T , Alloc >& lhs, const vector< T , Alloc >& rhs )
 	{
-		return ( lhs.size() == rhs.size() && equal( lhs.begin() , lhs.end() , rhs.begin() ));
+		return ( lhs.size() == rhs.size() && ft::equal( lhs.begin() , lhs.end() , rhs.begin() ));
 	}
 
 	//  (2) Operator !=  //
@@ -663,7 +662,7 @@ namespace ft
 	template < class T , class Alloc >
 	bool operator<( const vector< T , Alloc >& lhs , const vector< T , Alloc >& rhs )
 	{
-		return ( lexicographical_compare( lhs.begin() , lhs.end() , rhs.begin() , rhs.end()) );
+		return ( ft::lexicographical_compare( lhs.begin() , lhs.end() , rhs.begin() , rhs.end()) );
 	}
 
 	//  (4) Operator <=  //
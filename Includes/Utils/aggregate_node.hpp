@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   aggregate_node.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:05:33 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/17 14:05:33 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef AGGREGATE_NODE_HPP
+# define AGGREGATE_NODE_HPP
+
+# include <limits>
+# include "utility.hpp"
+# include "binary_search_tree.hpp"
+
+/*
+
+Monoid		--> associative operation with an identity element : 
+				op( op( a , b ) , c ) == op( a , op( b , c ) ) and 
+				op( identity() , a ) == op( a , identity() ) == a.
+				A monoid functor here provides :
+					- value_type, the type of aggregates,
+					- identity(),
+					- operator()( a , b ).
+				It needs not be commutative : values are combined in key order.
+				sum_monoid, min_monoid and max_monoid are ready to use.
+
+Aggregate node
+			--> tree node caching the monoid of the mapped values of its 
+				subtree, in key order. Its pull() recomputes it from both 
+				children, so the tree keeps it up to date on insert, erase and 
+				rotations like the subtree size. Its iterator_value is 
+				constant, so ft::map iterators over it are read only.
+
+Unless otherwise indicated all refs come from :
+	Introduction to Algorithms (Cormen, Leiserson, Rivest, Stein), chapter 14
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 MONOIDS													  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  sum_monoid : a + b, identity is T()  //
+	template< class T >
+	struct sum_monoid
+	{
+		typedef T	value_type;
+
+		value_type	identity( void ) const
+		{
+			return ( value_type() );
+		}
+
+		value_type	operator()( const value_type& a , const value_type& b ) const
+		{
+			return ( a + b );
+		}
+	};
+
+	//  min_monoid : smallest of a and b, identity is the biggest T  //
+	template< class T >
+	struct min_monoid
+	{
+		typedef T	value_type;
+
+		value_type	identity( void ) const
+		{
+			return ( std::numeric_limits< value_type >::max() );
+		}
+
+		value_type	operator()( const value_type& a , const value_type& b ) const
+		{
+			return ( ( b < a ) ? b : a );
+		}
+	};
+
+	//  max_monoid : biggest of a and b, identity is the smallest T  //
+	template< class T >
+	struct max_monoid
+	{
+		typedef T	value_type;
+
+		value_type	identity( void ) const
+		{
+			if ( std::numeric_limits< value_type >::is_integer )
+				return ( std::numeric_limits< value_type >::min() );
+			return ( -std::numeric_limits< value_type >::max() );
+		}
+
+		value_type	operator()( const value_type& a , const value_type& b ) const
+		{
+			return ( ( a < b ) ? b : a );
+		}
+	};
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 STRUCT AGGREGATE_NODE										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Monoid >
+	struct aggregate_node : public node< Key , T >
+	{
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												   	  	  */
+		/* ------------------------------------------------------------------ */
+
+		typedef typename Monoid::value_type		aggregate_type;
+		typedef const ft::pair< const Key , T >	iterator_value;		// constant : a mapped value written in place would leave aggregates stale
+
+		aggregate_type	aggregate;		// monoid of the mapped values of the subtree, in key order
+
+		/* ------------------------------------------------------------------ */
+		/* 	Constructors											   	  	  */
+		/* ------------------------------------------------------------------ */
+
+		//  (1) Default Constructor  //
+		aggregate_node( void ) : node< Key , T >() , aggregate( this->couple.second )
+		{
+			return ;
+		}
+
+		//  (2) One Constructor : a lone node aggregates its own mapped value  //
+		aggregate_node( const ft::pair< const Key , T >& val ) : node< Key , T >( val ) , aggregate( val.second )
+		{
+			return ;
+		}
+
+		//  (3) Copy Constructor  //
+		aggregate_node( const aggregate_node& x ) : node< Key , T >( x ) , aggregate( x.aggregate )
+		{
+			return ;
+		}
+
+		/* ------------------------------------------------------------------ */
+		/* 	Destructor												   		  */
+		/* ------------------------------------------------------------------ */
+
+		~aggregate_node( void )
+		{
+			return ;
+		}
+
+		/* ------------------------------------------------------------------ */
+		/* 	Subtree data											   		  */
+		/* ------------------------------------------------------------------ */
+
+		//  pull() : recompute subtree size and aggregate( left ) , value , aggregate( right )  //
+		static void	pull( node_base* current )
+		{
+			aggregate_node*	tmp = static_cast< aggregate_node* >( current );
+			Monoid			op;
+			aggregate_type	ret = tmp->couple.second;
+
+			node_base::pull( current );
+			if ( current->left )
+				ret = op( static_cast< aggregate_node* >( current->left )->aggregate , ret );
+			if ( current->right )
+				ret = op( ret , static_cast< aggregate_node* >( current->right )->aggregate );
+			tmp->aggregate = ret;
+			return ;
+		}
+
+		//  subtree_aggregate() : aggregate of a subtree, identity for a NULL leaf  //
+		static aggregate_type	subtree_aggregate( node_base* current )
+		{
+			if ( !current )
+				return ( Monoid().identity() );
+			return ( static_cast< aggregate_node* >( current )->aggregate );
+		}
+
+	}; /* struct aggregate_node */
+
+} /* namespace ft */
+
+#endif /* AGGREGATE_NODE_HPP */
@@ -13,8 +13,12 @@
 #ifndef BINARY_SEARCH_TREE_HPP
 # define BINARY_SEARCH_TREE_HPP
 
+# include <cstddef>
 # include <functional>
+# include <memory>
+# include <new>
 # include "utility.hpp"
+# include "node_pool.hpp"
 
 /*
 
@@ -26,51 +30,230 @@ Binary Search Tree
 				of data items. The basic operations include: search, traversal 
 				(iterators), insert and delete.
 
+Red-Black Tree
+			--> self-balancing binary search tree : every node is colored red 
+				or black, the root is black, a red node has no red child and 
+				every path from a node to its descendant leaves holds the same 
+				number of black nodes. Insert and delete restore these rules 
+				with recolorings and at most three rotations, so the height 
+				stays under 2 * log2( n + 1 ) whatever the order keys arrive in.
+
+Order statistics
+			--> every node also counts the nodes of its subtree. Insert and 
+				erase update the counts on the path to the root, a rotation 
+				recomputes the two nodes it moves. The node of index k 
+				(select) and the number of keys before a key (rank) are then 
+				found in a single descent, O(log n).
+
+Augmented nodes
+			--> the node type is a template parameter : the tree calls its 
+				static pull( node ) to recompute what a node caches about its 
+				subtree from its two children, on the same paths and 
+				rotations as the subtree size. A node type can cache more 
+				(see aggregate_node) without the tree knowing what.
+
+Header		--> sentinel node owned by the tree, holding no value : its parent 
+				is the root, its left and right are the smallest and biggest 
+				nodes and it is the root's parent. It is the past-the-end 
+				position, so begin(), end() and stepping back from end() are 
+				O(1). Empty tree : no root, left and right point to the header.
+
+Unless otherwise indicated all refs come from :
+	Introduction to Algorithms (Cormen, Leiserson, Rivest, Stein), chapters 13 and 14
+
 */
 
 namespace ft
 {
 	/* -----------------------------------------------------------------------*/
 	/*																	  	  */
-	/* 			 STRUCT NODE												  */
+	/* 			 NODE COLOR													  */
 	/*																		  */
 	/* -----------------------------------------------------------------------*/
 
-	template< class Key , class T >
-	struct node
+	enum	rb_color
+	{
+		rb_red ,
+		rb_black
+	};
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 STRUCT NODE_BASE											  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  links, color and subtree size : the tree header is a node_base, every other node is a node  //
+	struct node_base
 	{
 		/* ------------------------------------------------------------------ */
 		/* 	Attributes												   	  	  */
 		/* ------------------------------------------------------------------ */
 
-		node*						parent;		// parent node
-		node*						left;		// left node
-		node*						right;		// right node
-		ft::pair< const Key , T >*	couple;		// data node
+		node_base*	parent;		// parent node (header for the root)
+		node_base*	left;		// left node
+		node_base*	right;		// right node
+		rb_color	color;		// red-black color
+		std::size_t	size;		// number of nodes in the subtree rooted here
 
 		/* ------------------------------------------------------------------ */
 		/* 	Constructors											   	  	  */
 		/* ------------------------------------------------------------------ */
 
 		//  (1) Default Constructor  //
-		node( void ) : parent( NULL ) , left( NULL ) , right( NULL ) , couple( NULL )
+		node_base( void ) : parent( NULL ) , left( NULL ) , right( NULL ) , color( rb_red ) , size( 1 )
+		{
+			return ;
+		}
+
+		//  (2) Copy Constructor  //
+		node_base( const node_base& x ) : parent( x.parent ) , left( x.left ) , right( x.right ) , color( x.color ) , size( x.size )
+		{
+			return ;
+		}
+
+		/* ------------------------------------------------------------------ */
+		/* 	Destructor												   		  */
+		/* ------------------------------------------------------------------ */
+
+		~node_base( void )
+		{
+			return ;
+		}
+
+		/* ------------------------------------------------------------------ */
+		/* 	Traversal												   		  */
+		/* ------------------------------------------------------------------ */
+
+		//  is_header() : only the header is red with its grand parent being itself  //
+		bool	is_header( void ) const
+		{
+			return ( this->color == rb_red && this->parent && this->parent->parent == this );
+		}
+
+		//  minimum() : smallest node of the subtree  //
+		static node_base*	minimum( node_base* current )
+		{
+			while ( current->left )
+				current = current->left;
+			return ( current );
+		}
+
+		//  maximum() : biggest node of the subtree  //
+		static node_base*	maximum( node_base* current )
+		{
+			while ( current->right )
+				current = current->right;
+			return ( current );
+		}
+
+		//  increment() : in-order successor, the biggest node goes to the header  //
+		static node_base*	increment( node_base* current )
+		{
+			node_base*	tmp;
+
+			if ( current->right )
+				return ( minimum( current->right ) );
+			tmp = current->parent;
+			while ( current == tmp->right )
+			{
+				current = tmp;
+				tmp = tmp->parent;
+			}
+			if ( current->right != tmp )	// root without right child : its parent is the header
+				current = tmp;
+			return ( current );
+		}
+
+		//  decrement() : in-order predecessor, the header goes to the biggest node  //
+		static node_base*	decrement( node_base* current )
+		{
+			node_base*	tmp;
+
+			if ( current->is_header() )
+				return ( current->right );
+			if ( current->left )
+				return ( maximum( current->left ) );
+			tmp = current->parent;
+			while ( current == tmp->left )
+			{
+				current = tmp;
+				tmp = tmp->parent;
+			}
+			return ( tmp );
+		}
+
+		/* ------------------------------------------------------------------ */
+		/* 	Order statistics										   		  */
+		/* ------------------------------------------------------------------ */
+
+		//  pull() : recompute subtree size from both children  //
+		static void	pull( node_base* current )
 		{
+			current->size = subtree_size( current->left ) + subtree_size( current->right ) + 1;
 			return ;
 		}
 
-		//  (2) One Constructor  //
-		node( const ft::pair< const Key , T >& val ) : parent( NULL ), left( NULL ), right( NULL ), couple( NULL )
+		//  subtree_size() : number of nodes in the subtree, 0 for a NULL leaf  //
+		static std::size_t	subtree_size( node_base* current )
 		{
-			std::allocator< ft::pair< const Key , T > >	alloc;
+			return ( ( current ) ? current->size : 0 );
+		}
+
+		//  rank() : number of nodes before current in key order, climbing to the root ; the header of a non empty tree ranks last  //
+		static std::size_t	rank( node_base* current )
+		{
+			std::size_t	ret;
+
+			if ( current->is_header() )
+				return ( current->parent->size );
+			ret = subtree_size( current->left );
+			while ( !current->parent->is_header() )
+			{
+				if ( current == current->parent->right )
+					ret += subtree_size( current->parent->left ) + 1;
+				current = current->parent;
+			}
+			return ( ret );
+		}
+
+	}; /* struct node_base */
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 STRUCT NODE												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T >
+	struct node : public node_base
+	{
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												   	  	  */
+		/* ------------------------------------------------------------------ */
+
+		ft::pair< const Key , T >	couple;		// data node, stored inline
 
-			this->couple = alloc.allocate( 1 );
-			alloc.construct( this->couple , val );
+		typedef ft::pair< const Key , T >	iterator_value;		// element type map iterators give access to
 
+		/* ------------------------------------------------------------------ */
+		/* 	Constructors											   	  	  */
+		/* ------------------------------------------------------------------ */
+
+		//  (1) Default Constructor  //
+		node( void ) : node_base() , couple()
+		{
+			return ;
+		}
+
+		//  (2) One Constructor : pair is copy-constructed in place, no extra allocation  //
+		node( const ft::pair< const Key , T >& val ) : node_base() , couple( val )
+		{
 			return ;
 		}
 
 		//  (3) Copy Constructor  //
-		node( const node& x  ) : parent( x.parent ) , left( x.left ) , right( x.right ) , couple( x.couple )
+		node( const node& x  ) : node_base( x ) , couple( x.couple )
 		{
 			return ;
 		}
@@ -81,14 +264,6 @@ namespace ft
 
 		~node( void )
 		{
-			std::allocator< pair< const Key , T > >	alloc;
-			
-			if ( this->couple )
-			{
-				alloc.destroy( this->couple );
-				alloc.deallocate( this->couple , 1 );
-			 	this->couple = NULL;
-			}
 			return ;
 		}
 
@@ -100,7 +275,7 @@ namespace ft
 	/*																		  */
 	/* -----------------------------------------------------------------------*/
 
-	template< class Key, class T , class Compare = std::less< Key > , class Alloc = std::allocator< ft::pair< const Key , T > > >
+	template< class Key, class T , class Compare = std::less< Key > , class Alloc = std::allocator< ft::pair< const Key , T > > , class Node = node< Key , T > >
 	class tree
 	{
 		public :
@@ -119,16 +294,21 @@ namespace ft
 			typedef	typename allocator_type::pointer			pointer;
 			typedef	typename allocator_type::const_pointer		const_pointer;
 			typedef typename allocator_type::size_type			size_type;
-			typedef node< const Key , T >*						nodePtr;
-			typedef std::allocator< node< const key_type , mapped_type > >	nodeAlloc;
+			typedef Node										node_type;
+			typedef node_base*									basePtr;
+			typedef node_type*									nodePtr;
+			typedef typename Alloc::template rebind< node_type >::other	nodeAlloc;
+			typedef node_pool< node_type , nodeAlloc >			nodePool;
 
 		/* ------------------------------------------------------------------ */
 		/* 	Attributes												  	 	  */
 		/* ------------------------------------------------------------------ */
 
-			nodePtr		_root;		// tree root 
+			node_base	_header;	// sentinel : parent is root, left is smallest, right is biggest node
+			size_type	_size;		// number of nodes in the tree
 			Compare		_comp;		// map::key_compare
 			Alloc		_alloc;		// allocator object
+			nodePool	_pool;		// slabs every node is taken from
 
 		/* -------------------------------------------------------------------*/
 		/* 	Members functions												  */
@@ -136,8 +316,9 @@ namespace ft
 	
 			//  Constructor  //
 			tree( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() )
-				:  _root( NULL ), _comp( comp ), _alloc( alloc )
+				:  _header(), _size( 0 ), _comp( comp ), _alloc( alloc ), _pool( nodeAlloc( alloc ) )
 			{
+				this->reset_header();
 				return ;
 			}
 
@@ -146,174 +327,835 @@ namespace ft
 			{
 				return ;
 			}
+
+			//  key() : key of a node holding a value (never the header)  //
+			static const key_type&	key( basePtr current )
+			{
+				return ( static_cast< nodePtr >( current )->couple.first );
+			}
 		
-			//  new_node() : create a new node with pair parameters  //
+			//  new_node() : build a node with pair parameters in place, its memory taken from the pool (slabs of nodeAlloc)  //
 			nodePtr	new_node( const value_type& val )
 			{
-				nodeAlloc	alloc;
 				nodePtr		node_ptr;
 				
-				node_ptr = alloc.allocate( 1 );
-				alloc.construct( node_ptr , val );
-
+				node_ptr = this->_pool.allocate();
+				try
+				{
+					::new( static_cast< void* >( node_ptr ) ) node_type( val );
+				}
+				catch ( ... )
+				{
+					this->_pool.deallocate( node_ptr );
+					throw ;
+				}
 				return ( node_ptr );
 			}
 	
-			//  delete_tree() : delete tree  //
-			void	delete_tree( nodePtr current )
+			//  delete_tree() : destroy every node of the subtree, memory is given back by clear()  //
+			void	delete_tree( basePtr current )
 			{
-				nodeAlloc	tmp;
-				
 				if ( current->left )
 					delete_tree( current->left );
 				if ( current->right )
 					delete_tree( current->right );
-				tmp.destroy( current );
-				tmp.deallocate( current , 1 );
+				static_cast< nodePtr >( current )->~node_type();
 				current = NULL;
 				return ;
 			}
+
+			//  clear() : delete every node, release the pool slabs at once and reset the tree to empty  //
+			void	clear( void )
+			{
+				if ( this->root() )
+					this->delete_tree( this->root() );
+				this->_pool.release();
+				this->reset_header();
+				this->_size = 0;
+				return ;
+			}
 			
-			//  destroy_node() : destroy parameter node  //
-			void	destroy_node( nodePtr current )
+			//  destroy_node() : destroy parameter node, its memory goes back to the pool free list  //
+			void	destroy_node( basePtr current )
 			{
-				nodeAlloc	tmp;
-	
-				tmp.destroy( current );
-				tmp.deallocate( current , 1 );
+				nodePtr	tmp = static_cast< nodePtr >( current );
+
+				tmp->~node_type();
+				this->_pool.deallocate( tmp );
+				return ;
+			}
+
+			//  swap() : exchange content with x in O(1) : header links, count, comparator and pool are exchanged, no node is touched  //
+			//  but the root, whose parent is pointed back at its new header  //
+			void	swap( tree& x )
+			{
+				node_base	tmp_header	= this->_header;
+				size_type	tmp_size	= this->_size;
+				Compare		tmp_comp	= this->_comp;
+				Alloc		tmp_alloc	= this->_alloc;
+
+				this->_header = x._header;
+				this->_size = x._size;
+				this->_comp = x._comp;
+				this->_alloc = x._alloc;
+				x._header = tmp_header;
+				x._size = tmp_size;
+				x._comp = tmp_comp;
+				x._alloc = tmp_alloc;
+				this->_pool.swap( x._pool );
+				this->fix_header( x );
+				x.fix_header( *this );
 				return ;
 			}
 			
-			//  insert() : insert node value val  //
-			void	insert( const value_type& val )
+			//  insert() : insert val if its key is not in the tree yet, returns the node holding the key and whether it is new  //
+			ft::pair< basePtr , bool >	insert( const value_type& val )
 			{
-				if ( !this->_root )
-					this->_root = new_node( val );
+				basePtr	parent;
+				bool	right;
+				basePtr	found = this->insert_position( val.first , parent , right );
+
+				if ( found )
+					return ( ft::pair< basePtr , bool >( found , false ) );
+				return ( ft::pair< basePtr , bool >( this->insert_at( parent , right , val ) , true ) );
+			}
+
+			//  insert_hint() : insert val next to hint when it belongs there, otherwise fall back to insert() (hint may be end())  //
+			ft::pair< basePtr , bool >	insert_hint( basePtr hint , const value_type& val )
+			{
+				basePtr	neighbour;
+
+				if ( hint == this->end() )
+				{
+					if ( this->_size && this->_comp( key( this->rightmost() ) , val.first ) )
+						return ( ft::pair< basePtr , bool >( this->insert_at( this->rightmost() , true , val ) , true ) );
+				}
+				else if ( this->_comp( val.first , key( hint ) ) )
+				{
+					if ( hint == this->leftmost() )
+						return ( ft::pair< basePtr , bool >( this->insert_at( hint , false , val ) , true ) );
+					neighbour = node_base::decrement( hint );
+					if ( this->_comp( key( neighbour ) , val.first ) )
+					{
+						if ( !neighbour->right )
+							return ( ft::pair< basePtr , bool >( this->insert_at( neighbour , true , val ) , true ) );
+						return ( ft::pair< basePtr , bool >( this->insert_at( hint , false , val ) , true ) );
+					}
+				}
+				else if ( this->_comp( key( hint ) , val.first ) )
+				{
+					if ( hint == this->rightmost() )
+						return ( ft::pair< basePtr , bool >( this->insert_at( hint , true , val ) , true ) );
+					neighbour = node_base::increment( hint );
+					if ( this->_comp( val.first , key( neighbour ) ) )
+					{
+						if ( !hint->right )
+							return ( ft::pair< basePtr , bool >( this->insert_at( hint , true , val ) , true ) );
+						return ( ft::pair< basePtr , bool >( this->insert_at( neighbour , false , val ) , true ) );
+					}
+				}
 				else
+					return ( ft::pair< basePtr , bool >( hint , false ) );
+				return ( this->insert( val ) );
+			}
+
+			//  insert_position() : single descent for k, returns node equal to k or NULL and the leaf slot (parent, side) where k belongs  //
+			basePtr	insert_position( const key_type& k , basePtr& parent , bool& right ) const
+			{
+				basePtr	current = this->root();
+				basePtr	candidate = NULL;	// greatest node whose key does not go after k
+
+				parent = this->end();
+				right = false;
+				while ( current )
 				{
-					nodePtr tmp = this->_root;
-					
-					while ( 19 )
+					parent = current;
+					right = !this->_comp( k , key( current ) );
+					if ( right )
 					{
-						if ( this->_comp( tmp->couple->first , val.first ) )
-						{
-							if ( !tmp->right )
-							{
-								tmp->right = new_node( val );
-								tmp->right->parent = tmp;
-								break ;
-							}
-							else
-								tmp = tmp->right;
-						}
-						else
-						{
-							if ( !tmp->left )
-							{
-								tmp->left = new_node( val );
-								tmp->left->parent = tmp;
-								break ;
-							}
-							else
-								tmp = tmp->left;
-						}
+						candidate = current;
+						current = current->right;
 					}
+					else
+						current = current->left;
 				}
-				return ;
+				if ( candidate && !this->_comp( key( candidate ) , k ) )
+					return ( candidate );
+				return ( NULL );
+			}
+
+			//  insert_at() : link a new node holding val as child of parent (root if parent is the header), then restore red-black properties  //
+			basePtr	insert_at( basePtr parent , bool right , const value_type& val )
+			{
+				basePtr	added = new_node( val );
+
+				added->parent = parent;
+				if ( parent == this->end() )
+				{
+					this->_header.parent = added;
+					this->_header.left = added;
+					this->_header.right = added;
+				}
+				else if ( right )
+				{
+					parent->right = added;
+					if ( parent == this->rightmost() )
+						this->_header.right = added;
+				}
+				else
+				{
+					parent->left = added;
+					if ( parent == this->leftmost() )
+						this->_header.left = added;
+				}
+				this->pull_path( added );
+				this->insert_fixup( added );
+				++this->_size;
+				return ( added );
 			}
 			
 			//  erase() : return true if something is erased  //
 			bool	erase( const key_type& k )
 			{
-				nodePtr tmp = this->search( k );
-				if ( !this->_root || !tmp )
+				basePtr		tmp = this->search( k );
+
+				if ( tmp == this->end() )
 				{					
 				 	return ( false );
 				}
-				if ( tmp == this->_root )
+				this->erase_node( tmp );
+				return ( true );
+			}
+
+			//  erase_node() : unlink tmp (never the header) without searching its key, destroy it and rebalance  //
+			//  Other nodes are only relinked, so iterators on them stay valid  //
+			void	erase_node( basePtr tmp )
+			{
+				this->unlink_node( tmp );
+				this->destroy_node( tmp );
+				return ;
+			}
+
+			//  unlink_node() : take tmp out of the tree and rebalance, tmp itself is left untouched  //
+			//  Subtree data is pulled up from where the node that really left its place (tmp, or its successor) was  //
+			void	unlink_node( basePtr tmp )
+			{
+				basePtr		child;
+				basePtr		child_parent;
+				basePtr		next;
+				rb_color	removed_color;
+
+				if ( tmp == this->leftmost() )
+					this->_header.left = ( tmp->right ) ? node_base::minimum( tmp->right ) : tmp->parent;
+				if ( tmp == this->rightmost() )
+					this->_header.right = ( tmp->left ) ? node_base::maximum( tmp->left ) : tmp->parent;
+				removed_color = tmp->color;
+				if ( !tmp->left || !tmp->right )
+				{
+					child = ( tmp->left ) ? tmp->left : tmp->right;
+					child_parent = tmp->parent;
+					this->transplant( tmp , child );
+				}
+				else
 				{
-					if ( !tmp->left && !tmp->right )
+					next = node_base::minimum( tmp->right );
+					removed_color = next->color;
+					child = next->right;
+					if ( next->parent == tmp )
+						child_parent = next;
+					else
 					{
-						this->_root = NULL;
+						child_parent = next->parent;
+						this->transplant( next , next->right );
+						next->right = tmp->right;
+						next->right->parent = next;
 					}
-					else if ( !tmp->left )
+					this->transplant( tmp , next );
+					next->left = tmp->left;
+					next->left->parent = next;
+					next->color = tmp->color;
+				}
+				--this->_size;
+				if ( child_parent != this->end() )
+					this->pull_path( child_parent );
+				if ( removed_color == rb_black )
+					this->erase_fixup( child , child_parent );
+				return ;
+			}
+
+			//  side() : return side of the child compared to parent (left = false, right = true)  //
+			bool	side( basePtr child , basePtr parent ) const
+			{
+				if ( parent->left == child )
+					return ( false );
+				return ( true );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      BALANCING                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  is_red() : return true if node exists and is red (NULL leaves are black)  //
+			bool	is_red( basePtr current ) const
+			{
+				return ( current && current->color == rb_red );
+			}
+
+			//  transplant() : replace subtree rooted at old_node by subtree rooted at replacement  //
+			void	transplant( basePtr old_node , basePtr replacement )
+			{
+				if ( old_node == this->root() )
+					this->_header.parent = replacement;
+				else if ( !this->side( old_node , old_node->parent ) )
+					old_node->parent->left = replacement;
+				else
+					old_node->parent->right = replacement;
+				if ( replacement )
+					replacement->parent = old_node->parent;
+				return ;
+			}
+
+			//  rotate_left() : right child of current takes its place, current becomes its left child  //
+			void	rotate_left( basePtr current )
+			{
+				basePtr	pivot = current->right;
+
+				current->right = pivot->left;
+				if ( pivot->left )
+					pivot->left->parent = current;
+				this->transplant( current , pivot );
+				pivot->left = current;
+				current->parent = pivot;
+				node_type::pull( current );
+				node_type::pull( pivot );
+				return ;
+			}
+
+			//  rotate_right() : left child of current takes its place, current becomes its right child  //
+			void	rotate_right( basePtr current )
+			{
+				basePtr	pivot = current->left;
+
+				current->left = pivot->right;
+				if ( pivot->right )
+					pivot->right->parent = current;
+				this->transplant( current , pivot );
+				pivot->right = current;
+				current->parent = pivot;
+				node_type::pull( current );
+				node_type::pull( pivot );
+				return ;
+			}
+
+			//  pull_path() : pull subtree data of current and every node above it, up to the root  //
+			void	pull_path( basePtr current )
+			{
+				for ( ; current != this->end() ; current = current->parent )
+					node_type::pull( current );
+				return ;
+			}
+
+			//  insert_fixup() : repaint and rotate from the new red node up until no red node has a red parent  //
+			//  Returns true when the root had to be painted black, which grows the black height by one  //
+			bool	insert_fixup( basePtr current )
+			{
+				bool	grown;
+
+				basePtr	uncle;
+				basePtr	grand_parent;
+
+				while ( current != this->root() && this->is_red( current->parent ) )
+				{
+					grand_parent = current->parent->parent;
+					if ( current->parent == grand_parent->left )
 					{
-						tmp->right->parent = NULL;
-						this->_root = tmp->right;
+						uncle = grand_parent->right;
+						if ( this->is_red( uncle ) )
+						{
+							current->parent->color = rb_black;
+							uncle->color = rb_black;
+							grand_parent->color = rb_red;
+							current = grand_parent;
+							continue ;
+						}
+						if ( current == current->parent->right )
+						{
+							current = current->parent;
+							this->rotate_left( current );
+						}
+						current->parent->color = rb_black;
+						grand_parent->color = rb_red;
+						this->rotate_right( grand_parent );
 					}
-					else if ( !tmp->right )
+					else
+					{
+						uncle = grand_parent->left;
+						if ( this->is_red( uncle ) )
+						{
+							current->parent->color = rb_black;
+							uncle->color = rb_black;
+							grand_parent->color = rb_red;
+							current = grand_parent;
+							continue ;
+						}
+						if ( current == current->parent->left )
+						{
+							current = current->parent;
+							this->rotate_right( current );
+						}
+						current->parent->color = rb_black;
+						grand_parent->color = rb_red;
+						this->rotate_left( grand_parent );
+					}
+				}
+				grown = this->is_red( this->root() );
+				this->root()->color = rb_black;
+				return ( grown );
+			}
+
+			//  erase_fixup() : give back the missing black to the branch of current (may be a NULL leaf, hence parent)  //
+			void	erase_fixup( basePtr current , basePtr parent )
+			{
+				basePtr	sibling;
+
+				while ( current != this->root() && !this->is_red( current ) )
+				{
+					if ( current == parent->left )
 					{
-						tmp->left->parent = NULL;
-						this->_root = tmp->left;
+						sibling = parent->right;
+						if ( this->is_red( sibling ) )
+						{
+							sibling->color = rb_black;
+							parent->color = rb_red;
+							this->rotate_left( parent );
+							sibling = parent->right;
+						}
+						if ( !this->is_red( sibling->left ) && !this->is_red( sibling->right ) )
+						{
+							sibling->color = rb_red;
+							current = parent;
+							parent = current->parent;
+							continue ;
+						}
+						if ( !this->is_red( sibling->right ) )
+						{
+							sibling->left->color = rb_black;
+							sibling->color = rb_red;
+							this->rotate_right( sibling );
+							sibling = parent->right;
+						}
+						sibling->color = parent->color;
+						parent->color = rb_black;
+						sibling->right->color = rb_black;
+						this->rotate_left( parent );
 					}
 					else
 					{
-						tmp->right->parent = NULL;
-						tmp->left->parent = this->down_smallest_node( tmp->right );
-						( this->down_smallest_node( tmp->right ) )->left = tmp->left;
-						this->_root = tmp->right;
-						tmp = NULL;
+						sibling = parent->left;
+						if ( this->is_red( sibling ) )
+						{
+							sibling->color = rb_black;
+							parent->color = rb_red;
+							this->rotate_right( parent );
+							sibling = parent->left;
+						}
+						if ( !this->is_red( sibling->left ) && !this->is_red( sibling->right ) )
+						{
+							sibling->color = rb_red;
+							current = parent;
+							parent = current->parent;
+							continue ;
+						}
+						if ( !this->is_red( sibling->left ) )
+						{
+							sibling->right->color = rb_black;
+							sibling->color = rb_red;
+							this->rotate_left( sibling );
+							sibling = parent->left;
+						}
+						sibling->color = parent->color;
+						parent->color = rb_black;
+						sibling->left->color = rb_black;
+						this->rotate_right( parent );
 					}
-				 	return ( true );
+					current = this->root();
 				}
-				
-				bool side = this->side( tmp , tmp->parent );
+				if ( current )
+					current->color = rb_black;
+				return ;
+			}
 
-				if ( !tmp->left && !tmp->right )
+			/* -------------------------------------------------------------- */
+			/*                      COPY                           			  */
+			/* -------------------------------------------------------------- */
+
+			//  assign() : make this a node-for-node copy of x, in one traversal and without any comparison  //
+			//  Current nodes are first given back to the pool free list, so the copy reuses them  //
+			void	assign( const tree& x )
+			{
+				if ( this == &x )
+					return ;
+				this->recycle();
+				this->_comp = x._comp;
+				if ( x.root() )
 				{
-					if ( !side )
-						tmp->parent->left = NULL;
-					else
-						tmp->parent->right = NULL;
-					
-					destroy_node( tmp );
-					tmp = NULL;
-					return ( true );
+					this->_header.parent = this->copy_tree( x.root() , &this->_header );
+					this->_header.left = node_base::minimum( this->_header.parent );
+					this->_header.right = node_base::maximum( this->_header.parent );
+					this->_size = x._size;
 				}
-				else if ( !tmp->left || !tmp->right )
+				return ;
+			}
+
+			//  copy_tree() : copy subtree src (values, shape and colors) under parent, recursing on right children only  //
+			//  The left spine is pulled bottom-up once built, every node is pulled once  //
+			basePtr	copy_tree( basePtr src , basePtr parent )
+			{
+				basePtr	top = this->clone_node( src , parent );
+				basePtr	current;
+
+				try
 				{
-					if ( !tmp->left )
+					if ( src->right )
+						top->right = this->copy_tree( src->right , top );
+					parent = top;
+					src = src->left;
+					while ( src )
 					{
-						tmp->right->parent = tmp->parent;
-						if ( !side )
-							tmp->parent->left = tmp->right;
-						else
-							tmp->parent->right = tmp->right;
+						current = this->clone_node( src , parent );
+						parent->left = current;
+						if ( src->right )
+							current->right = this->copy_tree( src->right , current );
+						parent = current;
+						src = src->left;
 					}
-					else
+					for ( ; parent != top ; parent = parent->parent )
+						node_type::pull( parent );
+					node_type::pull( top );
+				}
+				catch ( ... )
+				{
+					this->free_tree( top );
+					throw ;
+				}
+				return ( top );
+			}
+
+			//  clone_node() : new node holding a copy of src value, with src color and given parent  //
+			basePtr	clone_node( basePtr src , basePtr parent )
+			{
+				basePtr	ret = this->new_node( static_cast< nodePtr >( src )->couple );
+
+				ret->color = src->color;
+				ret->parent = parent;
+				return ( ret );
+			}
+
+			//  free_tree() : destroy every node of the subtree and give their memory back to the pool free list  //
+			void	free_tree( basePtr current )
+			{
+				if ( current->left )
+					this->free_tree( current->left );
+				if ( current->right )
+					this->free_tree( current->right );
+				this->destroy_node( current );
+				return ;
+			}
+
+			//  recycle() : empty the tree, keeping node memory in the pool for reuse  //
+			void	recycle( void )
+			{
+				if ( this->root() )
+					this->free_tree( this->root() );
+				this->reset_header();
+				this->_size = 0;
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      BULK BUILD                     			  */
+			/* -------------------------------------------------------------- */
+
+			//  build_sorted() : fill an empty tree from [first, last[ in one pass  //
+			//  Nodes are chained while keys strictly increase (equal keys are dropped), then linked into a  //
+			//  balanced tree in O(n) ; the rest of an unsorted input is inserted one by one  //
+			//  trusted : caller guarantees sorted unique keys, no comparison is made  //
+			template< class InputIterator >
+			void	build_sorted( InputIterator first , InputIterator last , bool trusted )
+			{
+				basePtr		head = NULL;
+				basePtr		tail = NULL;
+				size_type	count = 0;
+
+				try
+				{
+					for ( ; first != last ; ++first )
 					{
-						tmp->left->parent = tmp->parent;
-						if ( !side )
-							tmp->parent->left = tmp->left;
+						if ( tail && !trusted && !this->_comp( key( tail ) , ( *first ).first ) )
+						{
+							if ( this->_comp( ( *first ).first , key( tail ) ) )
+								break ;
+							continue ;
+						}
+						basePtr	added = new_node( *first );
+
+						if ( tail )
+							tail->right = added;
 						else
-							tmp->parent->right = tmp->left;
+							head = added;
+						tail = added;
+						++count;
 					}
-					destroy_node( tmp) ;
-					return ( true ) ;
 				}
-				else
+				catch ( ... )
 				{
-					tmp->right->parent = tmp->parent;
-					tmp->left->parent = this->down_smallest_node( tmp->right );
-					( this->down_smallest_node( tmp->right ) )->left = tmp->left;
-					if ( !side )
-						tmp->parent->left = tmp->right;
+					this->destroy_chain( head );
+					throw ;
+				}
+				if ( count )
+				{
+					this->_header.parent = this->build_balanced( head , count , 0 , this->log2( count ) );
+					this->_header.parent->parent = &this->_header;
+					this->_header.parent->color = rb_black;
+					this->_header.left = node_base::minimum( this->_header.parent );
+					this->_header.right = node_base::maximum( this->_header.parent );
+					this->_size = count;
+				}
+				for ( ; first != last ; ++first )
+					this->insert_hint( this->end() , *first );
+				return ;
+			}
+
+			//  build_balanced() : link the count first nodes of the chain (linked by right) into a balanced subtree  //
+			//  Every level is full but the deepest one, which is painted red so black heights match  //
+			basePtr	build_balanced( basePtr& chain , size_type count , size_type depth , size_type red_depth )
+			{
+				basePtr		middle;
+				basePtr		left;
+				size_type	left_count = ( count - 1 ) / 2;
+
+				if ( !count )
+					return ( NULL );
+				left = this->build_balanced( chain , left_count , depth + 1 , red_depth );
+				middle = chain;
+				chain = chain->right;
+				middle->left = left;
+				if ( left )
+					left->parent = middle;
+				middle->right = this->build_balanced( chain , count - 1 - left_count , depth + 1 , red_depth );
+				if ( middle->right )
+					middle->right->parent = middle;
+				middle->color = ( depth == red_depth && depth ) ? rb_red : rb_black;
+				node_type::pull( middle );
+				return ( middle );
+			}
+
+			//  destroy_chain() : destroy nodes linked by right  //
+			void	destroy_chain( basePtr chain )
+			{
+				basePtr	next;
+
+				while ( chain )
+				{
+					next = chain->right;
+					this->destroy_node( chain );
+					chain = next;
+				}
+				return ;
+			}
+
+			//  log2() : floor of base 2 logarithm of n (n > 0)  //
+			static size_type	log2( size_type n )
+			{
+				size_type	ret = 0;
+
+				while ( n >>= 1 )
+					++ret;
+				return ( ret );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      SPLIT AND JOIN                 			  */
+			/* -------------------------------------------------------------- */
+
+			//  split() : move every node whose key does not go before k to out (cleared first), no node is copied  //
+			//  The subtrees hanging off the search path for k are joined back bottom-up, each join costs the  //
+			//  black height difference of its two sides, and those add up to O(log n)  //
+			void	split( const key_type& k , tree& out )
+			{
+				basePtr		current = this->root();
+				basePtr		next;
+				basePtr		parent;
+				basePtr		left = NULL;
+				basePtr		right = NULL;
+				size_type	height = this->black_height();
+				size_type	left_height = 0;
+				size_type	right_height = 0;
+				size_type	child_height;
+
+				out.clear();
+				out._pool.share( this->_pool );
+				if ( !current )
+					return ;
+				while ( ( next = ( this->_comp( key( current ) , k ) ) ? current->right : current->left ) )
+				{
+					height -= ( current->color == rb_black );
+					current = next;
+				}
+				for ( ; current != this->end() ; current = parent )
+				{
+					parent = current->parent;
+					child_height = height - ( current->color == rb_black );
+					if ( this->_comp( key( current ) , k ) )
+						left = this->join_nodes( current->left , child_height , current , left , left_height , left_height );
 					else
-						tmp->parent->right = tmp->right;
-					destroy_node( tmp );
-					return ( true );
+						right = this->join_nodes( right , right_height , current , current->right , child_height , right_height );
+					if ( parent != this->end() )
+						height += ( parent->color == rb_black );
 				}
-				return ( false );
+				this->set_root( left );
+				out.set_root( right );
+				return ;
 			}
 
-			//  side() : return side of the child compared to parent (left = false, right = true)  //
-			bool	side( nodePtr child , nodePtr parent ) const
+			//  join() : move every node of x into this, x is left empty, no node is copied  //
+			//  All keys of x must go after (or all before) those of this : false and nothing done otherwise  //
+			//  The edge node of x next to this is unlinked and becomes the middle of a black height join, O(log n)  //
+			bool	join( tree& x )
 			{
-				if ( parent->left == child )
+				basePtr		middle;
+				basePtr		joined;
+				size_type	height;
+				size_type	this_height;
+				size_type	x_height;
+				bool		after;
+
+				if ( !x._size )
+					return ( true );
+				if ( !this->_size || this->_comp( key( this->rightmost() ) , key( x.leftmost() ) ) )
+					after = true;
+				else if ( this->_comp( key( x.rightmost() ) , key( this->leftmost() ) ) )
+					after = false;
+				else
 					return ( false );
+				this->_pool.adopt( x._pool );
+				middle = ( after ) ? x.leftmost() : x.rightmost();
+				x.unlink_node( middle );
+				this_height = this->black_height();
+				x_height = x.black_height();
+				if ( after )
+					joined = this->join_nodes( this->root() , this_height , middle , x.root() , x_height , height );
+				else
+					joined = this->join_nodes( x.root() , x_height , middle , this->root() , this_height , height );
+				this->set_root( joined );
+				x.reset_header();
+				x._size = 0;
 				return ( true );
 			}
 
+			//  join_nodes() : link subtrees left < middle < right into one and return its root, black, and its black height  //
+			//  middle is hung, red, along the spine of the higher subtree where black heights match, then insert_fixup  //
+			//  clears a red parent ; the header stands in for the root of the subtree being joined  //
+			basePtr	join_nodes( basePtr left , size_type left_height , basePtr middle , basePtr right , size_type right_height , size_type& height )
+			{
+				basePtr	current;
+				basePtr	parent = this->end();
+				bool	right_spine = ( left_height + this->is_red( left ) >= right_height + this->is_red( right ) );
+
+				if ( this->is_red( left ) )
+				{
+					left->color = rb_black;
+					++left_height;
+				}
+				if ( this->is_red( right ) )
+				{
+					right->color = rb_black;
+					++right_height;
+				}
+				current = ( right_spine ) ? left : right;
+				height = ( right_spine ) ? left_height : right_height;
+				this->_header.parent = current;
+				if ( current )
+					current->parent = this->end();
+				while ( this->is_red( current ) || height > ( ( right_spine ) ? right_height : left_height ) )
+				{
+					height -= ( current->color == rb_black );
+					parent = current;
+					current = ( right_spine ) ? current->right : current->left;
+				}
+				middle->left = ( right_spine ) ? current : left;
+				middle->right = ( right_spine ) ? right : current;
+				if ( middle->left )
+					middle->left->parent = middle;
+				if ( middle->right )
+					middle->right->parent = middle;
+				middle->parent = parent;
+				middle->color = rb_red;
+				if ( parent == this->end() )
+					this->_header.parent = middle;
+				else if ( right_spine )
+					parent->right = middle;
+				else
+					parent->left = middle;
+				this->pull_path( middle );
+				height = ( right_spine ) ? left_height : right_height;
+				if ( this->insert_fixup( middle ) )
+					++height;
+				return ( this->root() );
+			}
+
+			//  black_height() : black nodes on a path from the root down to a leaf  //
+			size_type	black_height( void ) const
+			{
+				basePtr		current = this->root();
+				size_type	ret = 0;
+
+				for ( ; current ; current = current->left )
+					ret += ( current->color == rb_black );
+				return ( ret );
+			}
+
+			//  set_root() : make root (parent ignored, may be NULL) the whole tree, header and size follow  //
+			void	set_root( basePtr root )
+			{
+				if ( !root )
+				{
+					this->reset_header();
+					this->_size = 0;
+					return ;
+				}
+				this->_header.parent = root;
+				root->parent = &this->_header;
+				this->_header.left = node_base::minimum( root );
+				this->_header.right = node_base::maximum( root );
+				this->_size = root->size;
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      HEADER                         			  */
+			/* -------------------------------------------------------------- */
+
+			//  reset_header() : header of an empty tree  //
+			void	reset_header( void )
+			{
+				this->_header.parent = NULL;
+				this->_header.left = &this->_header;
+				this->_header.right = &this->_header;
+				this->_header.color = rb_red;
+				return ;
+			}
+
+			//  fix_header() : header copied from other, point root back at this header (or reset it if empty)  //
+			void	fix_header( const tree& other )
+			{
+				if ( this->_header.parent )
+					this->_header.parent->parent = &this->_header;
+				else if ( this->_header.left == &other._header )
+					this->reset_header();
+				return ;
+			}
+
 			/* -------------------------------------------------------------- */
 			/*                      CAPACITY                       			  */
 			/* -------------------------------------------------------------- */
@@ -321,84 +1163,186 @@ namespace ft
 			//  empty() : return true if tree is empty  //
 			bool	empty( void ) const
 			{
-				if ( !this->_root )
-					return ( true );
-				return ( false );
+				return ( this->_size == 0 );
+			}
+
+			//  size() : return number of nodes, kept up to date by insert, erase and clear  //
+			size_type	size( void ) const
+			{
+				return ( this->_size );
 			}
 
 			/* -------------------------------------------------------------- */
 			/*                      FIND                           			  */
 			/* -------------------------------------------------------------- */
 
-			//  ret_root() : return a copy of tree root  //
-			nodePtr	ret_root( void ) const
+			//  (1) root() : tree root, NULL if empty  //
+			basePtr&	root( void )
 			{
-				nodePtr tmp = this->_root;
+				return ( this->_header.parent );
+			}
 
-				return ( tmp );
+			//  (2) root() : same but const  //
+			basePtr	root( void ) const
+			{
+				return ( this->_header.parent );
 			}
 
-			//  begin() : return the smallest node  //
-			nodePtr	begin( void ) const
+			//  leftmost() : smallest node, cached in header  //
+			basePtr	leftmost( void ) const
 			{
-				nodePtr tmp = this->_root;
-				
-				if ( !tmp )
-					return ( NULL );
-				if ( !tmp->left )
+				return ( this->_header.left );
+			}
+
+			//  rightmost() : biggest node, cached in header  //
+			basePtr	rightmost( void ) const
+			{
+				return ( this->_header.right );
+			}
+
+			//  begin() : return the smallest node (the header if empty)  //
+			basePtr	begin( void ) const
+			{
+				return ( this->_header.left );
+			}
+
+			//  end() : return the header, the past-the-end position  //
+			basePtr	end( void ) const
+			{
+				return ( const_cast< basePtr >( &this->_header ) );
+			}
+
+			//  Lookups are templated on the probe type K : map only passes something else than a key_type when  //
+			//  Compare is transparent, so the probe is compared against stored keys without being converted  //
+
+			//  search() : search for parameter node in tree, returns it or returns end()  //
+			template< class K >
+			basePtr	search( const K& k ) const
+			{
+				basePtr tmp = this->lower_bound( k );
+
+				if ( tmp != this->end() && !this->_comp( k , key( tmp ) ) )
 					return ( tmp );
-				while ( tmp->left )
+				return ( this->end() );
+			}
+
+			//  lower_bound() : returns first node whose key does not go before k, end() if none  //
+			template< class K >
+			basePtr	lower_bound( const K& k ) const
+			{
+				return ( this->lower_bound( this->root() , this->end() , k ) );
+			}
+
+			//  lower_bound() : same, descending from current, ret being the best candidate found above it  //
+			template< class K >
+			basePtr	lower_bound( basePtr current , basePtr ret , const K& k ) const
+			{
+				while ( current )
 				{
-					tmp = tmp->left;
+					if ( !this->_comp( key( current ) , k ) )
+					{
+						ret = current;
+						current = current->left;
+					}
+					else
+						current = current->right;
 				}
-				return ( tmp );
+				return ( ret );
 			}
 
-			//  end() : return the biggest node  //
-			nodePtr	end( void ) const
+			//  upper_bound() : returns first node whose key goes after k, end() if none  //
+			template< class K >
+			basePtr	upper_bound( const K& k ) const
 			{
-				nodePtr tmp = this->_root;
-				
-				if ( !tmp )
-					return ( NULL );
-				if ( !tmp->right )
-					return ( tmp );
-				while ( tmp->right )
+				return ( this->upper_bound( this->root() , this->end() , k ) );
+			}
+
+			//  upper_bound() : same, descending from current, ret being the best candidate found above it  //
+			template< class K >
+			basePtr	upper_bound( basePtr current , basePtr ret , const K& k ) const
+			{
+				while ( current )
 				{
-					tmp = tmp->right;
+					if ( this->_comp( k , key( current ) ) )
+					{
+						ret = current;
+						current = current->left;
+					}
+					else
+						current = current->right;
 				}
-				return ( tmp );
+				return ( ret );
 			}
 
-			//  search() : search for parameter node in tree, returns it or returns false  //
-			nodePtr	search( const key_type& k ) const
+			//  equal_range() : lower and upper bounds of k, sharing the descent down to the first node equal to k  //
+			template< class K >
+			ft::pair< basePtr , basePtr >	equal_range( const K& k ) const
 			{
-				nodePtr tmp = this->_root;
+				basePtr	current = this->root();
+				basePtr	upper = this->end();
 
-				if ( !tmp )
-					return ( NULL );
-				while ( tmp ) 
+				while ( current )
 				{
-					if ( this->_comp( tmp->couple->first , k ) && tmp->right )
-						tmp = tmp->right;
-					else if ( this->_comp( k , tmp->couple->first ) && tmp->left )
-						tmp = tmp->left;
-					else if ( this->_comp( k , tmp->couple->first ) == false && this->_comp( tmp->couple->first , k ) == false )
-						break;
+					if ( this->_comp( key( current ) , k ) )
+						current = current->right;
+					else if ( this->_comp( k , key( current ) ) )
+					{
+						upper = current;
+						current = current->left;
+					}
 					else
-						tmp = NULL;
+					{
+						return ( ft::pair< basePtr , basePtr >( this->lower_bound( current->left , current , k ) ,
+																this->upper_bound( current->right , upper , k ) ) );
+					}
 				}
-				return ( tmp );
+				return ( ft::pair< basePtr , basePtr >( upper , upper ) );
 			}
 
-			//  down_smallest_node() : returns smallest node  //
-			nodePtr	down_smallest_node( nodePtr src ) const
+			/* -------------------------------------------------------------- */
+			/*                      ORDER STATISTICS               			  */
+			/* -------------------------------------------------------------- */
+
+			//  select() : node of index k in key order, end() if k is out of range  //
+			basePtr	select( size_type k ) const
 			{
-				nodePtr tmp = src;
+				basePtr		current = this->root();
+				size_type	left_size;
 
-				while ( tmp->left )
-					tmp = tmp->left;
-				return ( tmp );
+				while ( current )
+				{
+					left_size = node_base::subtree_size( current->left );
+					if ( k < left_size )
+						current = current->left;
+					else if ( k == left_size )
+						return ( current );
+					else
+					{
+						k -= left_size + 1;
+						current = current->right;
+					}
+				}
+				return ( this->end() );
+			}
+
+			//  rank() : number of keys going before k, counted during a single descent  //
+			template< class K >
+			size_type	rank( const K& k ) const
+			{
+				basePtr		current = this->root();
+				size_type	ret = 0;
+
+				while ( current )
+				{
+					if ( this->_comp( key( current ) , k ) )
+					{
+						ret += node_base::subtree_size( current->left ) + 1;
+						current = current->right;
+					}
+					else
+						current = current->left;
+				}
+				return ( ret );
 			}
 
 			/* -------------------------------------------------------------- */
@@ -441,6 +1385,12 @@ namespace ft
 				return ( value_compare( _comp ) );
 			}
 
+		private :
+
+			//  Not copyable : nodes belong to one tree, use assign() or swap()  //
+			tree( const tree& x );
+			tree&	operator=( const tree& x );
+
 	}; /* class tree */
 
 } /* namespace ft */
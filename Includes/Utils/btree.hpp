@@ -0,0 +1,1118 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   btree.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 11:02:19 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/17 11:02:19 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BTREE_HPP
+# define BTREE_HPP
+
+# include <cstddef>
+# include <functional>
+# include <memory>
+# include <new>
+
+# include "utility.hpp"
+# include "iterator.hpp"
+
+/*
+
+B+ Tree	--> balanced search tree whose nodes hold many sorted entries, sized 
+			to a few cache lines (target_node_bytes) :
+			- leaves hold the values ( pair< const Key , T > ) in a contiguous 
+			  array and are chained in key order, so a scan reads them one 
+			  after the other,
+			- inner nodes hold a contiguous array of separator keys and one 
+			  more child than keys : every key of children[ i ] goes before 
+			  keys[ i ], which does not go after any key of children[ i + 1 ].
+			Searching a node is a binary search over its contiguous keys, and 
+			the tree is only log( n ) / log( slots ) nodes high, so a lookup 
+			touches a handful of cache lines instead of one per level.
+			Every node but the root is kept at least half full : an 
+			underflowing node borrows from a sibling or is merged with it. 
+			Appending past the biggest key does not split the last nodes in 
+			half but opens a new one, so sorted input fills nodes completely.
+			Insert and erase may move values between nodes : they invalidate 
+			every iterator.
+
+Unless otherwise indicated all refs come from :
+	https://en.wikipedia.org/wiki/B%2B_tree
+	https://abseil.io/about/design/btree
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 BTREE NODES												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  common part of leaves and inner nodes  //
+	struct btree_node
+	{
+		btree_node*		parent;		// parent inner node, NULL for root
+		unsigned short	position;	// index in parent children
+		unsigned short	count;		// number of values (leaf) or keys (inner)
+		bool			leaf;		// leaf or inner node
+	};
+
+	//  leaf : N values in contiguous raw storage, chained to its neighbours  //
+	template< class V , std::size_t N >
+	struct btree_leaf : public btree_node
+	{
+		btree_leaf*		prev;		// previous leaf in key order
+		btree_leaf*		next;		// next leaf in key order
+		union
+		{
+			char		bytes[ sizeof( V ) * N ];
+			void*		align_ptr;
+			double		align_double;
+			long double	align_long_double;
+		}				storage;	// values, constructed in place
+
+		V*	slot( std::size_t i )
+		{
+			return ( reinterpret_cast< V* >( this->storage.bytes ) + i );
+		}
+	};
+
+	//  inner node : N separator keys in contiguous raw storage and N + 1 children  //
+	template< class K , std::size_t N >
+	struct btree_inner : public btree_node
+	{
+		btree_node*		children[ N + 1 ];
+		union
+		{
+			char		bytes[ sizeof( K ) * N ];
+			void*		align_ptr;
+			double		align_double;
+			long double	align_long_double;
+		}				storage;	// keys, constructed in place
+
+		K*	key( std::size_t i )
+		{
+			return ( reinterpret_cast< K* >( this->storage.bytes ) + i );
+		}
+	};
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 BTREE ITERATOR												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  position is a leaf and a slot in it, past-the-end is one past the last slot of the last leaf  //
+	template< class T , class Leaf >
+	class btree_iterator
+	{
+		public :
+
+			//  Members type  //
+			typedef ft::bidirectional_iterator_tag	iterator_category;
+			typedef T								value_type;
+			typedef std::ptrdiff_t					difference_type;
+			typedef T*								pointer;
+			typedef T&								reference;
+
+			//  Attributes  //
+			Leaf*		_leaf;		// current leaf
+			std::size_t	_pos;		// current slot in leaf
+
+		/* -------------------------------------------------------------------*/
+		/* 			 MEMBER FUNCTIONS 										  */
+		/* -------------------------------------------------------------------*/
+
+			//  (1) Default constructor  //
+			btree_iterator( void ) : _leaf( NULL ) , _pos( 0 )
+			{
+				return ;
+			}
+
+			//  (2) Position constructor  //
+			btree_iterator( Leaf* leaf , std::size_t pos ) : _leaf( leaf ) , _pos( pos )
+			{
+				return ;
+			}
+
+			//  (3) Copy constructor  //
+			btree_iterator( const btree_iterator< typename remove_const< T >::type , Leaf >& x ) : _leaf( x._leaf ) , _pos( x._pos )
+			{
+				return ;
+			}
+
+			//  Destructor  //
+			~btree_iterator( void )
+			{
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			btree_iterator&	operator=( const btree_iterator& rhs )
+			{
+				this->_leaf = rhs._leaf;
+				this->_pos = rhs._pos;
+				return ( *this );
+			}
+
+			//  (1) Operator++ : pre-increment version, jumps to the next leaf after the last slot  //
+			btree_iterator&	operator++( void )
+			{
+				if ( ++this->_pos == this->_leaf->count && this->_leaf->next )
+				{
+					this->_leaf = this->_leaf->next;
+					this->_pos = 0;
+				}
+				return ( *this );
+			}
+
+			//  (2) Operator++ : post-increment version  //
+			btree_iterator	operator++( int )
+			{
+				btree_iterator	tmp = *this;
+
+				this->operator++();
+				return ( tmp );
+			}
+
+			//  (1) Operator-- : pre-decrement version, jumps to the previous leaf before the first slot  //
+			btree_iterator&	operator--( void )
+			{
+				if ( this->_pos == 0 )
+				{
+					this->_leaf = this->_leaf->prev;
+					this->_pos = this->_leaf->count;
+				}
+				--this->_pos;
+				return ( *this );
+			}
+
+			//  (2) Operator-- : post-decrement version  //
+			btree_iterator	operator--( int )
+			{
+				btree_iterator	tmp = *this;
+
+				this->operator--();
+				return ( tmp );
+			}
+
+			//  Operator* : dereference iterator : returns a reference to element pointed to by iterator  //
+			T&	operator*( void ) const
+			{
+				return ( *this->_leaf->slot( this->_pos ) );
+			}
+
+			//  Operator-> : dereference iterator, returns pointer to element pointed by iterator  //
+			T*	operator->( void ) const
+			{
+				return ( this->_leaf->slot( this->_pos ) );
+			}
+
+			//  Operator ==  //
+			bool	operator==( const btree_iterator rhs ) const
+			{
+				return ( this->_leaf == rhs._leaf && this->_pos == rhs._pos );
+			}
+
+			//  Operator !=  //
+			bool	operator!=( const btree_iterator rhs ) const
+			{
+				return ( !( *this == rhs ) );
+			}
+
+	}; /* class btree_iterator */
+
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 CLASS BTREE												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Compare = std::less< Key > , class Alloc = std::allocator< ft::pair< const Key , T > > >
+	class btree
+	{
+		public :
+
+		/* ------------------------------------------------------------------ */
+		/* 	Members types											   		  */
+		/* ------------------------------------------------------------------ */
+
+			typedef	Key											key_type;
+			typedef	T											mapped_type;
+			typedef	ft::pair< const key_type , mapped_type >	value_type;
+			typedef	Compare										key_compare;
+			typedef	Alloc										allocator_type;
+			typedef typename allocator_type::size_type			size_type;
+
+			static const size_type	target_node_bytes = 256;
+			static const size_type	leaf_slots = ( target_node_bytes - sizeof( btree_node ) - 2 * sizeof( void* ) ) / sizeof( value_type ) > 3 ?
+												 ( target_node_bytes - sizeof( btree_node ) - 2 * sizeof( void* ) ) / sizeof( value_type ) : 3;
+			static const size_type	inner_slots = ( target_node_bytes - sizeof( btree_node ) - sizeof( void* ) ) / ( sizeof( key_type ) + sizeof( void* ) ) > 3 ?
+												  ( target_node_bytes - sizeof( btree_node ) - sizeof( void* ) ) / ( sizeof( key_type ) + sizeof( void* ) ) : 3;
+			static const size_type	min_leaf = leaf_slots / 2;
+			static const size_type	min_inner = inner_slots / 2;
+
+			typedef btree_leaf< value_type , leaf_slots >						leaf_type;
+			typedef btree_inner< key_type , inner_slots >						inner_type;
+			typedef btree_node*													basePtr;
+			typedef leaf_type*													leafPtr;
+			typedef inner_type*													innerPtr;
+			typedef typename Alloc::template rebind< leaf_type >::other			leafAlloc;
+			typedef typename Alloc::template rebind< inner_type >::other		innerAlloc;
+			typedef btree_iterator< value_type , leaf_type >					iterator;
+			typedef btree_iterator< const value_type , leaf_type >				const_iterator;
+
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												  	 	  */
+		/* ------------------------------------------------------------------ */
+
+			basePtr		_root;		// root node, NULL if empty
+			leafPtr		_first;		// leftmost leaf
+			leafPtr		_last;		// rightmost leaf
+			size_type	_size;		// number of values
+			Compare		_comp;		// key_compare
+			Alloc		_alloc;		// allocator object
+
+		/* -------------------------------------------------------------------*/
+		/* 	Members functions												  */
+		/* -------------------------------------------------------------------*/
+
+			//  Constructor  //
+			btree( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() )
+				: _root( NULL ) , _first( NULL ) , _last( NULL ) , _size( 0 ) , _comp( comp ) , _alloc( alloc )
+			{
+				return ;
+			}
+
+			//  Destructor  //
+			~btree( void )
+			{
+				this->clear();
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      ITERATORS                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  begin() : first slot of first leaf  //
+			iterator	begin( void ) const
+			{
+				return ( iterator( this->_first , 0 ) );
+			}
+
+			//  end() : one past the last slot of last leaf  //
+			iterator	end( void ) const
+			{
+				return ( iterator( this->_last , ( this->_last ) ? this->_last->count : 0 ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      CAPACITY                       			  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : return true if tree is empty  //
+			bool	empty( void ) const
+			{
+				return ( this->_size == 0 );
+			}
+
+			//  size() : number of values  //
+			size_type	size( void ) const
+			{
+				return ( this->_size );
+			}
+
+			//  max_size() : maximum number of values  //
+			size_type	max_size( void ) const
+			{
+				return ( this->_alloc.max_size() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      FIND                           			  */
+			/* -------------------------------------------------------------- */
+
+			//  find_leaf() : descend to the leaf where k is or belongs, NULL if empty  //
+			leafPtr	find_leaf( const key_type& k ) const
+			{
+				basePtr	current = this->_root;
+
+				while ( current && !current->leaf )
+				{
+					innerPtr	inner = static_cast< innerPtr >( current );
+
+					current = inner->children[ this->inner_upper( inner , k ) ];
+				}
+				return ( static_cast< leafPtr >( current ) );
+			}
+
+			//  inner_upper() : index of first separator going after k (child to descend into)  //
+			size_type	inner_upper( innerPtr inner , const key_type& k ) const
+			{
+				size_type	low = 0;
+				size_type	high = inner->count;
+				size_type	middle;
+
+				while ( low < high )
+				{
+					middle = ( low + high ) / 2;
+					if ( this->_comp( k , *inner->key( middle ) ) )
+						high = middle;
+					else
+						low = middle + 1;
+				}
+				return ( low );
+			}
+
+			//  leaf_lower() : index of first value whose key does not go before k  //
+			size_type	leaf_lower( leafPtr leaf , const key_type& k ) const
+			{
+				size_type	low = 0;
+				size_type	high = leaf->count;
+				size_type	middle;
+
+				while ( low < high )
+				{
+					middle = ( low + high ) / 2;
+					if ( this->_comp( leaf->slot( middle )->first , k ) )
+						low = middle + 1;
+					else
+						high = middle;
+				}
+				return ( low );
+			}
+
+			//  leaf_upper() : index of first value whose key goes after k  //
+			size_type	leaf_upper( leafPtr leaf , const key_type& k ) const
+			{
+				size_type	low = 0;
+				size_type	high = leaf->count;
+				size_type	middle;
+
+				while ( low < high )
+				{
+					middle = ( low + high ) / 2;
+					if ( this->_comp( k , leaf->slot( middle )->first ) )
+						high = middle;
+					else
+						low = middle + 1;
+				}
+				return ( low );
+			}
+
+			//  normalize() : one past the last slot of a leaf is the first slot of the next one  //
+			iterator	normalize( leafPtr leaf , size_type pos ) const
+			{
+				if ( leaf && pos == leaf->count && leaf->next )
+					return ( iterator( leaf->next , 0 ) );
+				return ( iterator( leaf , pos ) );
+			}
+
+			//  lower_bound() : first value whose key does not go before k  //
+			iterator	lower_bound( const key_type& k ) const
+			{
+				leafPtr	leaf = this->find_leaf( k );
+
+				if ( !leaf )
+					return ( this->end() );
+				return ( this->normalize( leaf , this->leaf_lower( leaf , k ) ) );
+			}
+
+			//  upper_bound() : first value whose key goes after k  //
+			iterator	upper_bound( const key_type& k ) const
+			{
+				leafPtr	leaf = this->find_leaf( k );
+
+				if ( !leaf )
+					return ( this->end() );
+				return ( this->normalize( leaf , this->leaf_upper( leaf , k ) ) );
+			}
+
+			//  equal_range() : lower and upper bounds of k from a single descent (keys are unique)  //
+			ft::pair< iterator , iterator >	equal_range( const key_type& k ) const
+			{
+				leafPtr		leaf = this->find_leaf( k );
+				size_type	pos;
+
+				if ( !leaf )
+					return ( ft::pair< iterator , iterator >( this->end() , this->end() ) );
+				pos = this->leaf_lower( leaf , k );
+				if ( pos < leaf->count && !this->_comp( k , leaf->slot( pos )->first ) )
+					return ( ft::pair< iterator , iterator >( this->normalize( leaf , pos ) , this->normalize( leaf , pos + 1 ) ) );
+				return ( ft::pair< iterator , iterator >( this->normalize( leaf , pos ) , this->normalize( leaf , pos ) ) );
+			}
+
+			//  find() : value with key k, end() if none  //
+			iterator	find( const key_type& k ) const
+			{
+				leafPtr		leaf = this->find_leaf( k );
+				size_type	pos;
+
+				if ( !leaf )
+					return ( this->end() );
+				pos = this->leaf_lower( leaf , k );
+				if ( pos < leaf->count && !this->_comp( k , leaf->slot( pos )->first ) )
+					return ( iterator( leaf , pos ) );
+				return ( this->end() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      INSERT                         			  */
+			/* -------------------------------------------------------------- */
+
+			//  insert_position() : single descent for k, iterator on k or NULL leaf with the slot where k belongs  //
+			bool	insert_position( const key_type& k , leafPtr& leaf , size_type& pos )
+			{
+				if ( !this->_root )
+				{
+					this->_root = this->new_leaf();
+					this->_first = static_cast< leafPtr >( this->_root );
+					this->_last = this->_first;
+				}
+				leaf = this->find_leaf( k );
+				pos = this->leaf_lower( leaf , k );
+				return ( pos < leaf->count && !this->_comp( k , leaf->slot( pos )->first ) );
+			}
+
+			//  insert() : insert val if its key is not in the tree yet  //
+			ft::pair< iterator , bool >	insert( const value_type& val )
+			{
+				leafPtr		leaf;
+				size_type	pos;
+
+				if ( this->insert_position( val.first , leaf , pos ) )
+					return ( ft::pair< iterator , bool >( iterator( leaf , pos ) , false ) );
+				return ( ft::pair< iterator , bool >( this->insert_at( leaf , pos , val ) , true ) );
+			}
+
+			//  insert_hint() : insert val right before hint when it belongs there in the same leaf, or after the last value  //
+			iterator	insert_hint( iterator hint , const value_type& val )
+			{
+				if ( hint == this->end() )
+				{
+					if ( this->_size && this->_comp( this->_last->slot( this->_last->count - 1 )->first , val.first ) )
+						return ( this->insert_at( this->_last , this->_last->count , val ) );
+				}
+				else if ( hint._pos > 0 && this->_comp( val.first , hint->first )
+						&& this->_comp( hint._leaf->slot( hint._pos - 1 )->first , val.first ) )
+					return ( this->insert_at( hint._leaf , hint._pos , val ) );
+				return ( this->insert( val ).first );
+			}
+
+			//  insert_at() : construct val at slot pos of leaf, splitting it when full  //
+			iterator	insert_at( leafPtr leaf , size_type pos , const value_type& val )
+			{
+				leafPtr		right;
+				size_type	middle;
+				bool		append = ( leaf == this->_last && pos == leaf->count );
+
+				if ( leaf->count < leaf_slots )
+				{
+					this->leaf_insert( leaf , pos , val );
+					return ( iterator( leaf , pos ) );
+				}
+				right = this->new_leaf();
+				right->prev = leaf;
+				right->next = leaf->next;
+				if ( leaf->next )
+					leaf->next->prev = right;
+				else
+					this->_last = right;
+				leaf->next = right;
+				if ( append )	// appending after the biggest key : keep left leaf full
+				{
+					this->leaf_insert( right , 0 , val );
+					this->insert_child( leaf , right->slot( 0 )->first , right );
+					return ( iterator( right , 0 ) );
+				}
+				middle = leaf->count / 2;
+				this->move_slots( right , 0 , leaf , middle , leaf->count - middle );
+				right->count = leaf->count - middle;
+				leaf->count = middle;
+				if ( pos <= middle )
+					this->leaf_insert( leaf , pos , val );
+				else
+					this->leaf_insert( right , pos - middle , val );
+				this->insert_child( leaf , right->slot( 0 )->first , right );
+				if ( pos <= middle )
+					return ( iterator( leaf , pos ) );
+				return ( iterator( right , pos - middle ) );
+			}
+
+			//  insert_child() : link right next to left in their parent, separated by key sep, splitting parents when full  //
+			void	insert_child( basePtr left , const key_type& sep , basePtr right )
+			{
+				innerPtr	parent = static_cast< innerPtr >( left->parent );
+				innerPtr	sibling;
+				size_type	pos;
+				size_type	middle;
+
+				if ( !parent )
+				{
+					parent = this->new_inner();
+					::new( static_cast< void* >( parent->key( 0 ) ) ) key_type( sep );
+					parent->count = 1;
+					this->set_child( parent , 0 , left );
+					this->set_child( parent , 1 , right );
+					this->_root = parent;
+					return ;
+				}
+				pos = left->position;
+				if ( parent->count < inner_slots )
+				{
+					this->inner_insert( parent , pos , sep , right );
+					return ;
+				}
+				sibling = this->new_inner();
+				if ( pos == parent->count && this->is_last_child( parent ) )
+					middle = parent->count - 1;		// appending after the biggest key : keep left node full
+				else
+					middle = parent->count / 2;
+				key_type	up( *parent->key( middle ) );
+
+				this->move_inner( sibling , parent , middle + 1 );
+				parent->key( middle )->~key_type();
+				parent->count = middle;
+				if ( pos <= middle )
+					this->inner_insert( parent , pos , sep , right );
+				else
+					this->inner_insert( sibling , pos - middle - 1 , sep , right );
+				this->insert_child( parent , up , sibling );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      ERASE                          			  */
+			/* -------------------------------------------------------------- */
+
+			//  erase() : erase value with key k, return true if something is erased  //
+			bool	erase( const key_type& k )
+			{
+				iterator	ite = this->find( k );
+
+				if ( ite == this->end() )
+					return ( false );
+				this->erase_at( ite );
+				return ( true );
+			}
+
+			//  erase_at() : destroy the value at position, rebalance, and return position of the next value  //
+			iterator	erase_at( iterator position )
+			{
+				leafPtr		leaf = position._leaf;
+				size_type	pos = position._pos;
+
+				leaf->slot( pos )->~value_type();
+				this->move_slots( leaf , pos , leaf , pos + 1 , leaf->count - pos - 1 );
+				--leaf->count;
+				--this->_size;
+				if ( leaf == this->_root )
+				{
+					if ( leaf->count == 0 )
+					{
+						this->delete_leaf( leaf );
+						this->_root = NULL;
+						this->_first = NULL;
+						this->_last = NULL;
+						return ( this->end() );
+					}
+					return ( this->normalize( leaf , pos ) );
+				}
+				if ( leaf->count < min_leaf )
+					this->rebalance_leaf( leaf , pos );
+				return ( this->normalize( leaf , pos ) );
+			}
+
+			//  clear() : destroy every value and node  //
+			void	clear( void )
+			{
+				if ( this->_root )
+					this->delete_subtree( this->_root );
+				this->_root = NULL;
+				this->_first = NULL;
+				this->_last = NULL;
+				this->_size = 0;
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      COPY                           			  */
+			/* -------------------------------------------------------------- */
+
+			//  assign() : node-for-node copy of x, leaves chained in order  //
+			void	assign( const btree& x )
+			{
+				leafPtr	prev = NULL;
+
+				if ( this == &x )
+					return ;
+				this->clear();
+				this->_comp = x._comp;
+				if ( !x._root )
+					return ;
+				try
+				{
+					this->_root = this->copy_node( x._root , prev );
+				}
+				catch ( ... )
+				{
+					this->clear();
+					throw ;
+				}
+				this->_last = prev;
+				this->_size = x._size;
+				return ;
+			}
+
+			//  swap() : exchange content with x, no value is touched  //
+			void	swap( btree& x )
+			{
+				basePtr		tmp_root	= this->_root;
+				leafPtr		tmp_first	= this->_first;
+				leafPtr		tmp_last	= this->_last;
+				size_type	tmp_size	= this->_size;
+				Compare		tmp_comp	= this->_comp;
+				Alloc		tmp_alloc	= this->_alloc;
+
+				this->_root = x._root;
+				this->_first = x._first;
+				this->_last = x._last;
+				this->_size = x._size;
+				this->_comp = x._comp;
+				this->_alloc = x._alloc;
+				x._root = tmp_root;
+				x._first = tmp_first;
+				x._last = tmp_last;
+				x._size = tmp_size;
+				x._comp = tmp_comp;
+				x._alloc = tmp_alloc;
+				return ;
+			}
+
+		private :
+
+			//  Not copyable : use assign() or swap()  //
+			btree( const btree& x );
+			btree&	operator=( const btree& x );
+
+			/* -------------------------------------------------------------- */
+			/*                      NODES                          			  */
+			/* -------------------------------------------------------------- */
+
+			//  new_leaf() : empty leaf from the rebound allocator  //
+			leafPtr	new_leaf( void )
+			{
+				leafAlloc	alloc( this->_alloc );
+				leafPtr		ret = alloc.allocate( 1 );
+
+				ret->parent = NULL;
+				ret->position = 0;
+				ret->count = 0;
+				ret->leaf = true;
+				ret->prev = NULL;
+				ret->next = NULL;
+				return ( ret );
+			}
+
+			//  new_inner() : empty inner node from the rebound allocator  //
+			innerPtr	new_inner( void )
+			{
+				innerAlloc	alloc( this->_alloc );
+				innerPtr	ret = alloc.allocate( 1 );
+
+				ret->parent = NULL;
+				ret->position = 0;
+				ret->count = 0;
+				ret->leaf = false;
+				return ( ret );
+			}
+
+			//  delete_leaf() : give back leaf memory, values must be destroyed  //
+			void	delete_leaf( leafPtr leaf )
+			{
+				leafAlloc	alloc( this->_alloc );
+
+				alloc.deallocate( leaf , 1 );
+				return ;
+			}
+
+			//  delete_inner() : give back inner node memory, keys must be destroyed  //
+			void	delete_inner( innerPtr inner )
+			{
+				innerAlloc	alloc( this->_alloc );
+
+				alloc.deallocate( inner , 1 );
+				return ;
+			}
+
+			//  delete_subtree() : destroy values, keys and nodes of the subtree  //
+			void	delete_subtree( basePtr current )
+			{
+				if ( current->leaf )
+				{
+					leafPtr	leaf = static_cast< leafPtr >( current );
+
+					for ( size_type i = 0 ; i < leaf->count ; ++i )
+						leaf->slot( i )->~value_type();
+					this->delete_leaf( leaf );
+					return ;
+				}
+				innerPtr	inner = static_cast< innerPtr >( current );
+
+				for ( size_type i = 0 ; i <= inner->count ; ++i )
+					this->delete_subtree( inner->children[ i ] );
+				for ( size_type i = 0 ; i < inner->count ; ++i )
+					inner->key( i )->~key_type();
+				this->delete_inner( inner );
+				return ;
+			}
+
+			//  copy_node() : copy of subtree src, prev being the last leaf copied so far  //
+			//  A node reaches its parent only once complete : if a copy throws, what was built is freed here  //
+			basePtr	copy_node( basePtr src , leafPtr& prev )
+			{
+				if ( src->leaf )
+					return ( this->copy_leaf( static_cast< leafPtr >( src ) , prev ) );
+
+				innerPtr	from = static_cast< innerPtr >( src );
+				innerPtr	inner = this->new_inner();
+
+				try
+				{
+					this->set_child( inner , 0 , this->copy_node( from->children[ 0 ] , prev ) );
+				}
+				catch ( ... )
+				{
+					this->delete_inner( inner );
+					throw ;
+				}
+				try
+				{
+					for ( size_type i = 0 ; i < from->count ; ++i )
+					{
+						::new( static_cast< void* >( inner->key( i ) ) ) key_type( *from->key( i ) );
+						try
+						{
+							this->set_child( inner , i + 1 , this->copy_node( from->children[ i + 1 ] , prev ) );
+						}
+						catch ( ... )
+						{
+							inner->key( i )->~key_type();
+							throw ;
+						}
+						++inner->count;
+					}
+				}
+				catch ( ... )
+				{
+					this->delete_subtree( inner );
+					throw ;
+				}
+				return ( inner );
+			}
+
+			//  copy_leaf() : copy of leaf src chained after prev, freed again if a value copy throws  //
+			leafPtr	copy_leaf( leafPtr src , leafPtr& prev )
+			{
+				leafPtr	leaf = this->new_leaf();
+
+				try
+				{
+					for ( size_type i = 0 ; i < src->count ; ++i )
+					{
+						::new( static_cast< void* >( leaf->slot( i ) ) ) value_type( *src->slot( i ) );
+						++leaf->count;
+					}
+				}
+				catch ( ... )
+				{
+					this->delete_subtree( leaf );
+					throw ;
+				}
+				leaf->prev = prev;
+				if ( prev )
+					prev->next = leaf;
+				else
+					this->_first = leaf;
+				prev = leaf;
+				return ( leaf );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      SLOTS                          			  */
+			/* -------------------------------------------------------------- */
+
+			//  move_slots() : move count values from src at from to dst at to (copy then destroy, ranges may overlap in one leaf)  //
+			void	move_slots( leafPtr dst , size_type to , leafPtr src , size_type from , size_type count )
+			{
+				if ( dst == src && to > from )
+				{
+					for ( size_type i = count ; i > 0 ; --i )
+					{
+						::new( static_cast< void* >( dst->slot( to + i - 1 ) ) ) value_type( *src->slot( from + i - 1 ) );
+						src->slot( from + i - 1 )->~value_type();
+					}
+					return ;
+				}
+				for ( size_type i = 0 ; i < count ; ++i )
+				{
+					::new( static_cast< void* >( dst->slot( to + i ) ) ) value_type( *src->slot( from + i ) );
+					src->slot( from + i )->~value_type();
+				}
+				return ;
+			}
+
+			//  leaf_insert() : construct val at slot pos of a leaf that is not full  //
+			void	leaf_insert( leafPtr leaf , size_type pos , const value_type& val )
+			{
+				this->move_slots( leaf , pos + 1 , leaf , pos , leaf->count - pos );
+				try
+				{
+					::new( static_cast< void* >( leaf->slot( pos ) ) ) value_type( val );
+				}
+				catch ( ... )
+				{
+					this->move_slots( leaf , pos , leaf , pos + 1 , leaf->count - pos );
+					throw ;
+				}
+				++leaf->count;
+				++this->_size;
+				return ;
+			}
+
+			//  set_child() : put child at index i of inner  //
+			void	set_child( innerPtr inner , size_type i , basePtr child )
+			{
+				inner->children[ i ] = child;
+				child->parent = inner;
+				child->position = i;
+				return ;
+			}
+
+			//  move_key() : copy key of src at from to dst at to, then destroy the source key  //
+			void	move_key( innerPtr dst , size_type to , innerPtr src , size_type from )
+			{
+				::new( static_cast< void* >( dst->key( to ) ) ) key_type( *src->key( from ) );
+				src->key( from )->~key_type();
+				return ;
+			}
+
+			//  replace_key() : separator i of inner becomes a copy of k  //
+			void	replace_key( innerPtr inner , size_type i , const key_type& k )
+			{
+				key_type	tmp( k );
+
+				inner->key( i )->~key_type();
+				::new( static_cast< void* >( inner->key( i ) ) ) key_type( tmp );
+				return ;
+			}
+
+			//  inner_insert() : insert separator sep at index pos and child right at pos + 1 of an inner node that is not full  //
+			void	inner_insert( innerPtr inner , size_type pos , const key_type& sep , basePtr right )
+			{
+				for ( size_type i = inner->count ; i > pos ; --i )
+				{
+					this->move_key( inner , i , inner , i - 1 );
+					this->set_child( inner , i + 1 , inner->children[ i ] );
+				}
+				::new( static_cast< void* >( inner->key( pos ) ) ) key_type( sep );
+				this->set_child( inner , pos + 1 , right );
+				++inner->count;
+				return ;
+			}
+
+			//  inner_remove() : remove separator pos and child pos + 1 of inner  //
+			void	inner_remove( innerPtr inner , size_type pos )
+			{
+				inner->key( pos )->~key_type();
+				for ( size_type i = pos + 1 ; i < inner->count ; ++i )
+				{
+					this->move_key( inner , i - 1 , inner , i );
+					this->set_child( inner , i , inner->children[ i + 1 ] );
+				}
+				--inner->count;
+				return ;
+			}
+
+			//  move_inner() : move keys from index from and the children after them into empty dst  //
+			void	move_inner( innerPtr dst , innerPtr src , size_type from )
+			{
+				size_type	i;
+
+				for ( i = from ; i < src->count ; ++i )
+				{
+					this->move_key( dst , i - from , src , i );
+					this->set_child( dst , i - from , src->children[ i ] );
+				}
+				this->set_child( dst , i - from , src->children[ i ] );
+				dst->count = src->count - from;
+				return ;
+			}
+
+			//  is_last_child() : true if node is on the rightmost path of the tree  //
+			bool	is_last_child( basePtr node ) const
+			{
+				while ( node->parent )
+				{
+					if ( node->position != node->parent->count )
+						return ( false );
+					node = node->parent;
+				}
+				return ( true );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      REBALANCE                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  rebalance_leaf() : refill an underflowing leaf from a sibling or merge them, leaf and pos follow the next value  //
+			void	rebalance_leaf( leafPtr& leaf , size_type& pos )
+			{
+				innerPtr	parent = static_cast< innerPtr >( leaf->parent );
+				size_type	i = leaf->position;
+				leafPtr		left = ( i > 0 ) ? static_cast< leafPtr >( parent->children[ i - 1 ] ) : NULL;
+				leafPtr		right = ( i < parent->count ) ? static_cast< leafPtr >( parent->children[ i + 1 ] ) : NULL;
+
+				if ( left && left->count > min_leaf )
+				{
+					this->move_slots( leaf , 1 , leaf , 0 , leaf->count );
+					this->move_slots( leaf , 0 , left , left->count - 1 , 1 );
+					--left->count;
+					++leaf->count;
+					++pos;
+					this->replace_key( parent , i - 1 , leaf->slot( 0 )->first );
+					return ;
+				}
+				if ( right && right->count > min_leaf )
+				{
+					this->move_slots( leaf , leaf->count , right , 0 , 1 );
+					this->move_slots( right , 0 , right , 1 , right->count - 1 );
+					++leaf->count;
+					--right->count;
+					this->replace_key( parent , i , right->slot( 0 )->first );
+					return ;
+				}
+				if ( left )
+				{
+					pos += left->count;
+					this->merge_leaves( left , leaf );
+					leaf = left;
+				}
+				else
+					this->merge_leaves( leaf , right );
+				this->rebalance_inner( parent );
+				return ;
+			}
+
+			//  merge_leaves() : move every value of right at the end of its left sibling, unlink and free right  //
+			void	merge_leaves( leafPtr left , leafPtr right )
+			{
+				innerPtr	parent = static_cast< innerPtr >( left->parent );
+
+				this->move_slots( left , left->count , right , 0 , right->count );
+				left->count += right->count;
+				left->next = right->next;
+				if ( right->next )
+					right->next->prev = left;
+				else
+					this->_last = left;
+				this->inner_remove( parent , left->position );
+				this->delete_leaf( right );
+				return ;
+			}
+
+			//  rebalance_inner() : refill an underflowing inner node from a sibling or merge them, collapse an empty root  //
+			void	rebalance_inner( innerPtr inner )
+			{
+				innerPtr	parent = static_cast< innerPtr >( inner->parent );
+				size_type	i;
+				innerPtr	left;
+				innerPtr	right;
+
+				if ( !parent )
+				{
+					if ( inner->count == 0 )
+					{
+						this->_root = inner->children[ 0 ];
+						this->_root->parent = NULL;
+						this->_root->position = 0;
+						this->delete_inner( inner );
+					}
+					return ;
+				}
+				if ( inner->count >= min_inner )
+					return ;
+				i = inner->position;
+				left = ( i > 0 ) ? static_cast< innerPtr >( parent->children[ i - 1 ] ) : NULL;
+				right = ( i < parent->count ) ? static_cast< innerPtr >( parent->children[ i + 1 ] ) : NULL;
+				if ( left && left->count > min_inner )
+				{
+					this->set_child( inner , inner->count + 1 , inner->children[ inner->count ] );
+					for ( size_type j = inner->count ; j > 0 ; --j )
+					{
+						this->move_key( inner , j , inner , j - 1 );
+						this->set_child( inner , j , inner->children[ j - 1 ] );
+					}
+					this->move_key( inner , 0 , parent , i - 1 );
+					this->set_child( inner , 0 , left->children[ left->count ] );
+					this->move_key( parent , i - 1 , left , left->count - 1 );
+					--left->count;
+					++inner->count;
+					return ;
+				}
+				if ( right && right->count > min_inner )
+				{
+					this->move_key( inner , inner->count , parent , i );
+					this->set_child( inner , inner->count + 1 , right->children[ 0 ] );
+					++inner->count;
+					this->move_key( parent , i , right , 0 );
+					for ( size_type j = 1 ; j < right->count ; ++j )
+					{
+						this->move_key( right , j - 1 , right , j );
+						this->set_child( right , j - 1 , right->children[ j ] );
+					}
+					this->set_child( right , right->count - 1 , right->children[ right->count ] );
+					--right->count;
+					return ;
+				}
+				if ( left )
+					this->merge_inners( left , inner );
+				else
+					this->merge_inners( inner , right );
+				this->rebalance_inner( parent );
+				return ;
+			}
+
+			//  merge_inners() : pull the separator down into left, append right keys and children, unlink and free right  //
+			void	merge_inners( innerPtr left , innerPtr right )
+			{
+				innerPtr	parent = static_cast< innerPtr >( left->parent );
+				size_type	i = left->position;
+				size_type	base = left->count + 1;
+
+				::new( static_cast< void* >( left->key( left->count ) ) ) key_type( *parent->key( i ) );
+				for ( size_type j = 0 ; j < right->count ; ++j )
+				{
+					this->move_key( left , base + j , right , j );
+					this->set_child( left , base + j , right->children[ j ] );
+				}
+				this->set_child( left , base + right->count , right->children[ right->count ] );
+				left->count += 1 + right->count;
+				this->inner_remove( parent , i );
+				this->delete_inner( right );
+				return ;
+			}
+
+	}; /* class btree */
+
+} /* namespace ft */
+
+#endif /* BTREE_HPP */
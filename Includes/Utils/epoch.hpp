@@ -0,0 +1,436 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   epoch.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:05:26 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 17:48:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+# include <cstddef>
+# include <new>
+# include <stdexcept>
+# include <pthread.h>
+
+/*
+
+Epoch based reclamation
+			--> lets lock-free structures free the nodes they unlink while 
+				other threads may still be reading them :
+					- a thread enters the domain before touching shared nodes 
+					  and leaves it afterwards, it is then pinned to the 
+					  global epoch it read,
+					- an unlinked node is retired with the global epoch read 
+					  after it was unlinked, only threads that entered before 
+					  may still hold it,
+					- the global epoch moves on once every pinned thread has 
+					  seen it, so two moves after the retire no thread can 
+					  hold the node anymore : collect() hands it back.
+				Each thread gets its own record per domain, found through 
+				its list of slots ( one POSIX thread specific key for the 
+				whole process, so there is no limit on live domains ), 
+				records are reused after their thread exits and freed with 
+				the domain.
+
+Unless otherwise indicated all refs come from :
+	Practical lock-freedom (Fraser), 2004, section 5.2.3
+	https://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_key_create.html
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 EPOCH NODE / RECORD										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  epoch_node : header of every object a domain reclaims  //
+	struct epoch_node
+	{
+		epoch_node*		retired_next;	// next node of the retired queue
+		std::size_t		retired_epoch;	// global epoch read once the node was unlinked
+	};
+
+	//  epoch_record : state of one thread in a domain  //
+	struct epoch_record
+	{
+		std::size_t		active;			// 1 while the thread is in the domain, read by other threads
+		std::size_t		epoch;			// global epoch the thread is pinned to, read by other threads
+		int				owned;			// 1 while a live thread uses this record
+		epoch_record*	next;			// next record of the domain, set before publication
+		std::size_t		nest;			// nested enter() count, owner only
+		epoch_node*		head;			// oldest retired node, owner only
+		epoch_node*		tail;			// newest retired node, owner only
+		std::size_t		retired;		// retires since the last try to move the epoch on, owner only
+		std::size_t		seed;			// per thread random state left to the structure, owner only
+
+		epoch_record( void ) : active( 0 ) , epoch( 0 ) , owned( 1 ) , next( NULL ) , nest( 0 ) , head( NULL ) , tail( NULL ) , \
+				retired( 0 ) , seed( reinterpret_cast< std::size_t >( this ) | 1 )
+		{
+			return ;
+		}
+	};
+
+	class epoch_domain;
+
+	//  epoch_slot : one domain's record in a thread's list, owned by the thread  //
+	struct epoch_slot
+	{
+		epoch_domain*	domain;			// domain of rec, may be gone : compared, not followed, unless live
+		std::size_t		id;				// domain id, tells a new domain at the same address apart
+		epoch_record*	rec;			// record of the thread in domain
+		epoch_slot*		next;			// next slot of the thread
+	};
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 CLASS EPOCH_DOMAIN											  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	class epoch_domain
+	{
+		public :
+
+			//  retires between two tries to move the global epoch on  //
+			static const std::size_t	advance_period = 64;
+
+		private :
+
+			std::size_t		_epoch;		// global epoch
+			epoch_record*	_records;	// every record ever made, newest first
+			std::size_t		_id;		// unique among every domain ever made
+			epoch_domain*	_live_prev;	// live domains list, under registry_lock()
+			epoch_domain*	_live_next;
+
+			epoch_domain( const epoch_domain& );
+			epoch_domain&	operator=( const epoch_domain& );
+
+			/* -------------------------------------------------------------- */
+			/* 	Process wide state			 								  */
+			/* -------------------------------------------------------------- */
+
+			//  Function statics : a single instance whatever the number of translation units  //
+
+			//  registry_lock() : guards the live domains list and the ids  //
+			static pthread_mutex_t&	registry_lock( void )
+			{
+				static pthread_mutex_t	lock = PTHREAD_MUTEX_INITIALIZER;
+
+				return ( lock );
+			}
+
+			//  live_domains() : head of the live domains list  //
+			static epoch_domain*&	live_domains( void )
+			{
+				static epoch_domain*	head = NULL;
+
+				return ( head );
+			}
+
+			//  slots_key() : the one thread specific key, created by the first domain  //
+			static pthread_key_t&	slots_key( void )
+			{
+				static pthread_key_t	key;
+
+				return ( key );
+			}
+
+			static int&	slots_key_error( void )
+			{
+				static int	error = 0;
+
+				return ( error );
+			}
+
+			static void	create_slots_key( void )
+			{
+				slots_key_error() = pthread_key_create( &slots_key() , &epoch_domain::release_slots );
+				return ;
+			}
+
+			//  is_live() : whether slot's domain is still there, under registry_lock()  //
+			static bool	is_live( const epoch_slot* slot )
+			{
+				for ( epoch_domain* d = live_domains() ; d ; d = d->_live_next )
+				{
+					if ( d == slot->domain && d->_id == slot->id )
+						return ( true );
+				}
+				return ( false );
+			}
+
+			//  release_slots() : thread exit, its records of live domains may go to other threads  //
+			//  Under registry_lock() : no domain can free its records meanwhile  //
+			static void	release_slots( void* head )
+			{
+				epoch_slot*	slot = static_cast< epoch_slot* >( head );
+				epoch_slot*	tmp;
+
+				pthread_mutex_lock( &registry_lock() );
+				while ( slot )
+				{
+					if ( is_live( slot ) )
+						__atomic_store_n( &slot->rec->owned , 0 , __ATOMIC_RELEASE );
+					tmp = slot->next;
+					delete slot;
+					slot = tmp;
+				}
+				pthread_mutex_unlock( &registry_lock() );
+				return ;
+			}
+
+			//  prune_slots() : drops the slots of gone domains from the calling thread's list  //
+			static epoch_slot*	prune_slots( epoch_slot* head )
+			{
+				epoch_slot**	link = &head;
+				epoch_slot*		tmp;
+
+				pthread_mutex_lock( &registry_lock() );
+				while ( *link )
+				{
+					if ( is_live( *link ) )
+						link = &( *link )->next;
+					else
+					{
+						tmp = *link;
+						*link = tmp->next;
+						delete tmp;
+					}
+				}
+				pthread_mutex_unlock( &registry_lock() );
+				return ( head );
+			}
+
+		public :
+
+			//  Constructor  //
+			epoch_domain( void ) : _epoch( 0 ) , _records( NULL ) , _id( 0 ) , _live_prev( NULL ) , _live_next( NULL )
+			{
+				static pthread_once_t	once = PTHREAD_ONCE_INIT;
+				static std::size_t		next_id = 0;
+
+				pthread_once( &once , &epoch_domain::create_slots_key );
+				if ( slots_key_error() )
+					throw ( std::runtime_error( "ft::epoch_domain" ) );
+				pthread_mutex_lock( &registry_lock() );
+				this->_id = next_id++;
+				this->_live_next = live_domains();
+				if ( this->_live_next )
+					this->_live_next->_live_prev = this;
+				live_domains() = this;
+				pthread_mutex_unlock( &registry_lock() );
+				return ;
+			}
+
+			//  Destructor : no thread may be in the domain, retired nodes must have been drained  //
+			//  Threads keep their slots : they are dropped on the next miss or at thread exit  //
+			~epoch_domain( void )
+			{
+				epoch_record*	tmp;
+
+				pthread_mutex_lock( &registry_lock() );
+				if ( this->_live_prev )
+					this->_live_prev->_live_next = this->_live_next;
+				else
+					live_domains() = this->_live_next;
+				if ( this->_live_next )
+					this->_live_next->_live_prev = this->_live_prev;
+				pthread_mutex_unlock( &registry_lock() );
+				while ( this->_records )
+				{
+					tmp = this->_records->next;
+					delete this->_records;
+					this->_records = tmp;
+				}
+				return ;
+			}
+
+			//  record() : record of the calling thread, an unowned one is taken over before a new one is made  //
+			//  A thread's slots are few : one per domain it used, those of gone domains pruned on a miss  //
+			epoch_record*	record( void )
+			{
+				epoch_slot*		head = static_cast< epoch_slot* >( pthread_getspecific( slots_key() ) );
+				epoch_slot*		slot;
+				epoch_record*	rec;
+				int				expected;
+
+				for ( slot = head ; slot ; slot = slot->next )
+				{
+					if ( slot->domain == this && slot->id == this->_id )
+						return ( slot->rec );
+				}
+				head = prune_slots( head );
+				if ( pthread_setspecific( slots_key() , head ) )
+					throw ( std::runtime_error( "ft::epoch_domain" ) );
+				for ( rec = __atomic_load_n( &this->_records , __ATOMIC_ACQUIRE ) ; rec ; rec = rec->next )
+				{
+					expected = 0;
+					if ( __atomic_compare_exchange_n( &rec->owned , &expected , 1 , false , __ATOMIC_ACQUIRE , __ATOMIC_RELAXED ) )
+						break ;
+				}
+				if ( !rec )
+				{
+					rec = new epoch_record();
+					rec->next = __atomic_load_n( &this->_records , __ATOMIC_RELAXED );
+					while ( !__atomic_compare_exchange_n( &this->_records , &rec->next , rec , true , __ATOMIC_RELEASE , __ATOMIC_RELAXED ) )
+						;
+				}
+				try
+				{
+					slot = new epoch_slot();
+				}
+				catch ( ... )
+				{
+					__atomic_store_n( &rec->owned , 0 , __ATOMIC_RELEASE );
+					throw ;
+				}
+				slot->domain = this;
+				slot->id = this->_id;
+				slot->rec = rec;
+				slot->next = head;
+				if ( pthread_setspecific( slots_key() , slot ) )
+				{
+					__atomic_store_n( &rec->owned , 0 , __ATOMIC_RELEASE );
+					delete slot;
+					throw ( std::runtime_error( "ft::epoch_domain" ) );
+				}
+				return ( rec );
+			}
+
+			//  enter() : pins rec to the global epoch, nested calls only count  //
+			//  active is published before the epoch is read : a thread moving the epoch on either waits for rec or is seen  //
+			void	enter( epoch_record* rec )
+			{
+				if ( rec->nest++ )
+					return ;
+				__atomic_store_n( &rec->active , 1 , __ATOMIC_SEQ_CST );
+				__atomic_store_n( &rec->epoch , __atomic_load_n( &this->_epoch , __ATOMIC_SEQ_CST ) , __ATOMIC_SEQ_CST );
+				return ;
+			}
+
+			//  leave() : unpins rec once the outermost enter() is left  //
+			void	leave( epoch_record* rec )
+			{
+				if ( --rec->nest )
+					return ;
+				__atomic_store_n( &rec->active , 0 , __ATOMIC_RELEASE );
+				return ;
+			}
+
+			//  retire() : queues node, already unlinked, until no thread can hold it anymore  //
+			void	retire( epoch_record* rec , epoch_node* node )
+			{
+				node->retired_next = NULL;
+				node->retired_epoch = __atomic_load_n( &this->_epoch , __ATOMIC_SEQ_CST );
+				if ( rec->tail )
+					rec->tail->retired_next = node;
+				else
+					rec->head = node;
+				rec->tail = node;
+				if ( ++rec->retired >= advance_period )
+				{
+					rec->retired = 0;
+					this->try_advance();
+				}
+				return ;
+			}
+
+			//  collect() : unqueues the nodes of rec retired two epochs ago or more, returns them chained by retired_next  //
+			epoch_node*	collect( epoch_record* rec )
+			{
+				std::size_t	epoch = __atomic_load_n( &this->_epoch , __ATOMIC_ACQUIRE );
+				epoch_node*	ret = rec->head;
+				epoch_node*	last = NULL;
+
+				while ( rec->head && rec->head->retired_epoch + 2 <= epoch )
+				{
+					last = rec->head;
+					rec->head = rec->head->retired_next;
+				}
+				if ( !last )
+					return ( NULL );
+				last->retired_next = NULL;
+				if ( !rec->head )
+					rec->tail = NULL;
+				return ( ret );
+			}
+
+			//  drain() : unqueues every retired node of every record, no thread may be in the domain  //
+			epoch_node*	drain( void )
+			{
+				epoch_node*	ret = NULL;
+
+				for ( epoch_record* rec = this->_records ; rec ; rec = rec->next )
+				{
+					if ( !rec->head )
+						continue ;
+					rec->tail->retired_next = ret;
+					ret = rec->head;
+					rec->head = NULL;
+					rec->tail = NULL;
+				}
+				return ( ret );
+			}
+
+		private :
+
+			//  try_advance() : moves the global epoch on if every active record is pinned to it  //
+			void	try_advance( void )
+			{
+				std::size_t	epoch = __atomic_load_n( &this->_epoch , __ATOMIC_SEQ_CST );
+
+				for ( epoch_record* rec = __atomic_load_n( &this->_records , __ATOMIC_ACQUIRE ) ; rec ; rec = rec->next )
+				{
+					if ( __atomic_load_n( &rec->active , __ATOMIC_SEQ_CST ) && __atomic_load_n( &rec->epoch , __ATOMIC_SEQ_CST ) != epoch )
+						return ;
+				}
+				__atomic_compare_exchange_n( &this->_epoch , &epoch , epoch + 1 , false , __ATOMIC_SEQ_CST , __ATOMIC_RELAXED );
+				return ;
+			}
+
+	}; /* class epoch_domain */
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 EPOCH GUARD												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  epoch_guard : calling thread in the domain for the guard lifetime  //
+	class epoch_guard
+	{
+		public :
+
+			epoch_guard( epoch_domain& domain , epoch_record* rec ) : _domain( domain ) , _rec( rec )
+			{
+				this->_domain.enter( this->_rec );
+				return ;
+			}
+
+			~epoch_guard( void )
+			{
+				this->_domain.leave( this->_rec );
+				return ;
+			}
+
+		private :
+
+			epoch_domain&	_domain;
+			epoch_record*	_rec;
+
+			epoch_guard( const epoch_guard& );
+			epoch_guard&	operator=( const epoch_guard& );
+	};
+
+} /* namespace ft */
+
+#endif /* EPOCH_HPP */
@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:17 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:17 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_HPP
+# define HASH_HPP
+
+# include <cstddef>
+# include <string>
+
+/*
+
+Hash		--> function object mapping a key to a std::size_t, equal keys 
+				giving equal values. Integers and pointers hash to 
+				themselves ( as most standard libraries do ), strings with 
+				FNV-1a : containers spread the result with hash_mix() 
+				before using its bits. Constants follow the width of 
+				std::size_t, 32 or 64 bits.
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/functional/hash/
+	http://www.isthe.com/chongo/tech/comp/fnv/
+	https://github.com/aappleby/smhasher ( MurmurHash3 finalizer )
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 HASH_MIX													  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  hash_bits : word size dependent constants, picked on sizeof( std::size_t )  //
+	//  64 bits constants are built from 32 bits halves, 32 bits targets never instantiate them  //
+	template< class T , std::size_t Bytes = sizeof( T ) >
+	struct hash_bits
+	{
+		//  mix() : MurmurHash3 64 bits finalizer  //
+		static T	mix( T h )
+		{
+			h ^= h >> 33;
+			h *= ( T( 0xff51afd7UL ) << 32 ) | 0xed558ccdUL;
+			h ^= h >> 33;
+			h *= ( T( 0xc4ceb9feUL ) << 32 ) | 0x1a85ec53UL;
+			h ^= h >> 33;
+			return ( h );
+		}
+
+		static T	fnv_basis( void )
+		{
+			return ( ( T( 0xcbf29ce4UL ) << 32 ) | 0x84222325UL );
+		}
+
+		static T	fnv_prime( void )
+		{
+			return ( ( T( 0x00000100UL ) << 32 ) | 0x000001b3UL );
+		}
+	};
+
+	template< class T >
+	struct hash_bits< T , 4 >
+	{
+		//  mix() : MurmurHash3 32 bits finalizer  //
+		static T	mix( T h )
+		{
+			h ^= h >> 16;
+			h *= 0x85ebca6bUL;
+			h ^= h >> 13;
+			h *= 0xc2b2ae35UL;
+			h ^= h >> 16;
+			return ( h );
+		}
+
+		static T	fnv_basis( void )
+		{
+			return ( 0x811c9dc5UL );
+		}
+
+		static T	fnv_prime( void )
+		{
+			return ( 0x01000193UL );
+		}
+	};
+
+	//  hash_mix() : MurmurHash3 finalizer of the size_t width, every input bit flips about half of the output bits  //
+	inline std::size_t	hash_mix( std::size_t h )
+	{
+		return ( hash_bits< std::size_t >::mix( h ) );
+	}
+
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 STRUCT HASH												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  Primary template : no hash for other types, specialize it  //
+	template< class T >
+	struct hash;
+
+	//  integral_hash : identity for integral types  //
+	template< class T >
+	struct integral_hash
+	{
+		typedef T				argument_type;
+		typedef std::size_t		result_type;
+
+		std::size_t	operator()( T val ) const
+		{
+			return ( static_cast< std::size_t >( val ) );
+		}
+	};
+
+	template<> struct hash< bool > : integral_hash< bool > {};
+	template<> struct hash< char > : integral_hash< char > {};
+	template<> struct hash< signed char > : integral_hash< signed char > {};
+	template<> struct hash< unsigned char > : integral_hash< unsigned char > {};
+	template<> struct hash< wchar_t > : integral_hash< wchar_t > {};
+	template<> struct hash< short > : integral_hash< short > {};
+	template<> struct hash< unsigned short > : integral_hash< unsigned short > {};
+	template<> struct hash< int > : integral_hash< int > {};
+	template<> struct hash< unsigned int > : integral_hash< unsigned int > {};
+	template<> struct hash< long > : integral_hash< long > {};
+	template<> struct hash< unsigned long > : integral_hash< unsigned long > {};
+
+	//  Pointers : the address  //
+	template< class T >
+	struct hash< T* >
+	{
+		typedef T*				argument_type;
+		typedef std::size_t		result_type;
+
+		std::size_t	operator()( T* val ) const
+		{
+			return ( reinterpret_cast< std::size_t >( val ) );
+		}
+	};
+
+	//  Strings : FNV-1a over the characters  //
+	template<>
+	struct hash< std::string >
+	{
+		typedef std::string		argument_type;
+		typedef std::size_t		result_type;
+
+		std::size_t	operator()( const std::string& val ) const
+		{
+			std::size_t	h = hash_bits< std::size_t >::fnv_basis();
+
+			for ( std::string::size_type i = 0 ; i < val.size() ; ++i )
+			{
+				h ^= static_cast< unsigned char >( val[ i ] );
+				h *= hash_bits< std::size_t >::fnv_prime();
+			}
+			return ( h );
+		}
+	};
+
+} /* namespace ft */
+
+#endif /* HASH_HPP */
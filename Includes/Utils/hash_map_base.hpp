@@ -0,0 +1,373 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_map_base.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 19:02:17 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 19:02:17 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_MAP_BASE_HPP
+# define HASH_MAP_BASE_HPP
+
+# include <cstddef>
+# include <stdexcept>
+
+# include "utility.hpp"
+# include "iterator.hpp"
+
+/*
+
+Hash map base
+			--> the part of ft::unordered_map and ft::flat_hash_map that 
+				does not depend on how their table stores and probes slots. 
+				Table ( robin_hood_table or swiss_table ) provides :
+					- find_slot( k ) : slot of key k, end_slot() if none,
+					- insert( val ) : ( slot of val key , inserted ),
+					- erase_slot( i ), clear(), swap(), at( i ) : an 
+					  iterator on slot i, begin() and end().
+				Erasing at an iterator and the hash policy ( buckets, load 
+				factor, rehash ) are left to each container : they differ 
+				with the table.
+
+Unless otherwise indicated all refs come from :
+	https://cplusplus.com/reference/unordered_map/unordered_map/
+
+*/
+
+namespace ft
+{
+	template< class Table >
+	class hash_map_base
+	{
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBERS TYPES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			typedef typename Table::key_type									key_type;
+			typedef typename Table::mapped_type									mapped_type;
+			typedef typename Table::value_type									value_type;
+			typedef typename Table::hasher										hasher;
+			typedef typename Table::key_equal									key_equal;
+			typedef typename Table::allocator_type								allocator_type;
+			typedef typename allocator_type::reference							reference;
+			typedef typename allocator_type::const_reference					const_reference;
+			typedef typename allocator_type::pointer							pointer;
+			typedef typename allocator_type::const_pointer						const_pointer;
+			typedef Table														data_table;
+			typedef typename data_table::iterator								iterator;
+			typedef typename data_table::const_iterator							const_iterator;
+			typedef typename ft::iterator_traits< iterator >::difference_type	difference_type;
+			typedef typename allocator_type::size_type							size_type;
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 ATTRIBUTES 											  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+		protected :
+
+			data_table	_table;		// used hash table
+
+		/* -------------------------------------------------------------------*/
+		/*																	  */
+		/* 			 MEMBER FUNCTIONS 										  */
+		/*																	  */
+		/* -------------------------------------------------------------------*/
+
+			/* -------------------------------------------------------------- */
+			/* 	Constructors											   	  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) Default Constructor : room for n elements without growing  //
+			hash_map_base( size_type n , const hasher& hf , const key_equal& eq , const allocator_type& alloc ) : _table( n , hf , eq , alloc )
+			{
+				return ;
+			}
+
+			//  (2) Copy Constructor : slot for slot copy, no hashing  //
+			hash_map_base( const hash_map_base& x ) : _table( x._table )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Destructor												   	  */
+			/* -------------------------------------------------------------- */
+
+			~hash_map_base( void )
+			{
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Operator '=' overload										  */
+			/* -------------------------------------------------------------- */
+
+			hash_map_base& operator=( const hash_map_base& x )
+			{
+				this->_table = x._table;
+				return ( *this );
+			}
+
+		public :
+
+			/* -------------------------------------------------------------- */
+			/* 	Iterators					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) begin : returns iterator pointing to the first element  //
+			iterator begin( void )
+			{
+				return ( this->_table.begin() );
+			}
+
+			//  (2) const begin : returns const iterator pointing to the first element  //
+			const_iterator begin( void ) const
+			{
+				return ( this->_table.begin() );
+			}
+
+			//  (1) end : returns iterator referring to the past-the-end element  //
+			iterator end( void )
+			{
+				return ( this->_table.end() );
+			}
+
+			//  (2) const end : returns const iterator referring to the past-the-end element  //
+			const_iterator end( void ) const
+			{
+				return ( this->_table.end() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Capacity					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  empty() : returns whether the container is empty (i.e. whether its size is 0) //
+			bool empty( void ) const
+			{
+				return ( this->_table._size == 0 );
+			}
+
+			//  size() : returns the number of elements in the container  //
+			size_type size( void ) const
+			{
+				return ( this->_table._size );
+			}
+
+			//  max_size() : returns maximum number of elements that the container can hold  //
+			size_type max_size( void ) const
+			{
+				return ( this->_table._alloc.max_size() );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Element access				 								  */
+			/* -------------------------------------------------------------- */
+
+			//  operator[] : if k matches the key of an element, returns a reference to its mapped value, else inserts it  //
+			mapped_type&	operator[]( const key_type& k )
+			{
+				size_type	i = this->_table.find_slot( k );
+
+				if ( i == this->_table.end_slot() )
+					i = this->_table.insert( value_type( k , mapped_type() ) ).first;
+				return ( this->_table._slots[ i ].second );
+			}
+
+			//  (1) at() : returns a reference to the mapped value of the element with key k, throws out_of_range if none  //
+			mapped_type&	at( const key_type& k )
+			{
+				size_type	i = this->_table.find_slot( k );
+
+				if ( i == this->_table.end_slot() )
+					throw ( std::out_of_range( "ft::hash_map_base::at" ) );
+				return ( this->_table._slots[ i ].second );
+			}
+
+			//  (2) at() : same but const  //
+			const mapped_type&	at( const key_type& k ) const
+			{
+				size_type	i = this->_table.find_slot( k );
+
+				if ( i == this->_table.end_slot() )
+					throw ( std::out_of_range( "ft::hash_map_base::at" ) );
+				return ( this->_table._slots[ i ].second );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Modifiers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) single insert() : inserts val if its key is not there yet  //
+			pair< iterator , bool >	insert( const value_type& val )
+			{
+				ft::pair< size_type , bool >	ret = this->_table.insert( val );
+
+				return ( pair< iterator , bool >( this->_table.at( ret.first ) , ret.second ) );
+			}
+
+			//  (2) with hint insert() : the slot comes from the hash, position is ignored  //
+			iterator	insert( const_iterator position , const value_type& val )
+			{
+				( void )position;
+				return ( this->insert( val ).first );
+			}
+
+			//  (3) range insert() : inserts elements from range [first, last[  //
+			template< class InputIterator >
+			void	insert( InputIterator first , InputIterator last )
+			{
+				while ( first != last )
+				{
+					this->_table.insert( *first );
+					first++;
+				}
+				return ;
+			}
+
+			//  erase() : removes the element (if) with the key equivalent to k ; erasing at iterators is the container's  //
+			size_type	erase( const key_type& k )
+			{
+				size_type	i = this->_table.find_slot( k );
+
+				if ( i == this->_table.end_slot() )
+					return ( 0 );
+				this->_table.erase_slot( i );
+				return ( 1 );
+			}
+
+			//  clear() : removes all elements, bucket_count() is kept  //
+			void	clear( void )
+			{
+				this->_table.clear();
+				return ;
+			}
+
+			//  swap() : exchanges container's content by the content of x, O(1)  //
+			void	swap( hash_map_base& x )
+			{
+				this->_table.swap( x._table );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Lookup						 								  */
+			/* -------------------------------------------------------------- */
+
+			//  (1) find() : iterator to the element with key k, end() if none  //
+			iterator	find( const key_type& k )
+			{
+				return ( this->_table.at( this->_table.find_slot( k ) ) );
+			}
+
+			//  (2) find() : same but const  //
+			const_iterator	find( const key_type& k ) const
+			{
+				return ( const_cast< data_table& >( this->_table ).at( this->_table.find_slot( k ) ) );
+			}
+
+			//  count() : 1 if an element has key k, 0 otherwise  //
+			size_type	count( const key_type& k ) const
+			{
+				return ( this->_table.find_slot( k ) != this->_table.end_slot() );
+			}
+
+			//  (1) equal_range : the element with key k and the one after it, or end() twice  //
+			pair< iterator , iterator >	equal_range( const key_type& k )
+			{
+				iterator	first = this->find( k );
+				iterator	last = first;
+
+				if ( first != this->end() )
+					++last;
+				return ( pair< iterator , iterator >( first , last ) );
+			}
+
+			//  (2) equal_range : same but const  //
+			pair< const_iterator , const_iterator >	equal_range( const key_type& k ) const
+			{
+				const_iterator	first = this->find( k );
+				const_iterator	last = first;
+
+				if ( first != this->end() )
+					++last;
+				return ( pair< const_iterator , const_iterator >( first , last ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/* 	Observers					 								  */
+			/* -------------------------------------------------------------- */
+
+			//  hash_function() : returns a copy of the hash object  //
+			hasher	hash_function( void ) const
+			{
+				return ( this->_table._hash );
+			}
+
+			//  key_eq() : returns a copy of the key equality object  //
+			key_equal	key_eq( void ) const
+			{
+				return ( this->_table._eq );
+			}
+
+			//  get_allocator() : returns a copy of allocator object associated with the container  //
+			allocator_type	get_allocator( void ) const
+			{
+				return ( this->_table._alloc );
+			}
+
+	}; /* class hash_map_base */
+
+	/* -------------------------------------------------------------------------*/
+	/*																			*/
+	/* 			 NON-MEMBER FUNCTIONS OVERLOADS									*/
+	/*																			*/
+	/* -------------------------------------------------------------------------*/
+
+	//  Both containers come here through their base : only maps of the same type compare or swap  //
+
+	//  (1) Operator == : same size and every element of lhs found in rhs with an equal mapped value  //
+	template< class Table >
+	bool	operator==( const hash_map_base< Table >& lhs , const hash_map_base< Table >& rhs )
+	{
+		typename hash_map_base< Table >::const_iterator	found;
+
+		if ( lhs.size() != rhs.size() )
+			return ( false );
+		for ( typename hash_map_base< Table >::const_iterator it = lhs.begin() ; it != lhs.end() ; ++it )
+		{
+			found = rhs.find( it->first );
+			if ( found == rhs.end() || !( found->second == it->second ) )
+				return ( false );
+		}
+		return ( true );
+	}
+
+	//  (2) Operator !=  //
+	template< class Table >
+	bool	operator!=( const hash_map_base< Table >& lhs , const hash_map_base< Table >& rhs )
+	{
+		return ( !( lhs == rhs ) );
+	}
+
+	//  swap() : exchanges x content by y's ( same type )  //
+	template< class Table >
+	void	swap( hash_map_base< Table >& x , hash_map_base< Table >& y )
+	{
+		x.swap( y );
+		return ;
+	}
+
+} /* namespace ft */
+
+#endif /* HASH_MAP_BASE_HPP */
@@ -50,11 +50,13 @@ Iterator	--> any object that, pointing to some element in a range of
 
 	Map iterator 
 			--> class of iterator capable of iterating thought the binary search 
-				tree using the iterator current position and the end of the 
-				branch.
+				tree using the iterator current position, the tree header being 
+				the past-the-end position.
 
 	Distance 
-			--> calcul number of element between first and last.
+			--> calcul number of element between first and last : constant 
+				for random access iterators, logarithmic for map iterators 
+				(ranks read from subtree sizes), linear otherwise.
 
 Unless otherwise indicated all refs come from :
 	https://cplusplus.com/reference/iterator/
@@ -600,41 +602,35 @@ namespace ft
 			//  Members type  //
 			typedef	typename T::first_type											key_type;
 			typedef	typename T::second_type											mapped_type;
-			typedef typename ft::iterator< map_iterator , T >::iterator_category	iterator_category;
+			typedef ft::bidirectional_iterator_tag									iterator_category;
 			typedef typename ft::iterator< map_iterator , T >::value_type			value_type;
 			typedef typename ft::iterator< map_iterator , T >::difference_type		difference_type;
 			typedef typename ft::iterator< map_iterator , T >::pointer				pointer;
 			typedef typename ft::iterator< map_iterator , T >::reference			reference;
 			typedef node< key_type , mapped_type >* 								nodePtr;
+			typedef node_base*														basePtr;
 
 			//  Attributes  //
-			nodePtr		_current;	// current node
-			nodePtr		_end;		// node branch bottom
+			basePtr		_current;	// current node, the tree header when past-the-end
 
 		/* -------------------------------------------------------------------*/
 		/* 			 MEMBER FUNCTIONS 										  */
 		/* -------------------------------------------------------------------*/
 
 			//  (1) Default constructor  //
-			map_iterator( void ) : _current( NULL ) , _end( NULL )
+			map_iterator( void ) : _current( NULL )
 			{
 				return ;
 			}
 
 			//  (2) Node constructor  //
-			map_iterator( nodePtr node ) : _current( node ) , _end( NULL )
+			map_iterator( basePtr node ) : _current( node )
 			{
 				return ;
 			}
 
-			//  (3) Full constructor  //
-			map_iterator( nodePtr node , nodePtr end ) : _current( node ) , _end( end )
-			{
-				return ;
-			}
-
-			//  (4) Copy constructor  //
-			map_iterator( const map_iterator< typename remove_const< T >::type >& x ) : _current( x._current ) , _end( x._end )
+			//  (3) Copy constructor  //
+			map_iterator( const map_iterator< typename remove_const< T >::type >& x ) : _current( x._current )
 			{
 				return ;
 			}
@@ -651,64 +647,14 @@ namespace ft
 				if ( this != &rhs )
 				{
 					this->_current = rhs._current;
-					this->_end = rhs._end;
 				}
 				return ( *this );
 			}
 
-			//  (1) Operator++ : pre-increment version  //
+			//  (1) Operator++ : pre-increment version, the biggest node goes to the header  //
 			map_iterator&	operator++( void )
 			{
-				if ( this->_current == NULL )
-				{
-					return ( *this );
-				}
-				else if ( !this->_current->parent && !this->_current->right )
-				{
-					this->_end = this->_current;
-					this->_current = NULL;
-				}
-				else if ( this->_current->right )
-				{
-					nodePtr	tmp;
- 
-					tmp = this->_current->right;
-
-					while ( tmp->left )
-					{
-							tmp = tmp->left;
-					}
-					this->_current = tmp;
-				}
-				else
-				{
-					nodePtr	tmp;
-
-					if ( !this->_current->right )
-					{
-						tmp = this->_current;
-
-						if ( tmp->parent->right != tmp && tmp != tmp->parent->left )
-						{
-								this->_current = NULL;
-								return ( *this );
-						}
-						while ( tmp->parent != NULL && tmp == tmp->parent->right )
-						{
-							tmp = tmp->parent;
-						}
-						tmp = tmp->parent;
-					}
-					else
-					{
-						tmp = this->_current->right;
-						while ( tmp->left )
-						{
-							tmp = tmp->left;
-						}
-					}
-					this->_current = tmp;
-				}
+				this->_current = node_base::increment( this->_current );
 				return ( *this );
 			}
 
@@ -721,57 +667,14 @@ namespace ft
 				return ( tmp );
 			}
 
-			//  (1) Operator-- : pre-increment version  //
+			//  (1) Operator-- : pre-decrement version, the header goes to the biggest node  //
 			map_iterator&	operator--( void )
 			{
-				if ( this->_current == NULL )
-				{
-					if ( this->_end )
-						this->_current = this->_end;
-					return ( *this );
-				}
-				else if ( !this->_current->parent && !this->_current->left )
-				{
-					this->_current = NULL;
-				}
-				else if ( this->_current->left )
-				{
-					nodePtr	tmp;
-
-					tmp = this->_current->left;
-					while ( tmp->right )
-					{
-						tmp = tmp->right; 
-					}
-					this->_current = tmp;
-				}
-				else
-				{
-					nodePtr	tmp;
-
-					if ( this->_current->left == NULL )
-					{
-						tmp = this->_current;
-						while ( tmp->parent != NULL && tmp == tmp->parent->left )
-						{
-							tmp = tmp->parent;
-						}
-						tmp = tmp->parent;
-					}
-					else
-					{
-						tmp = this->_current->left;
-						while ( tmp->right != NULL )
-						{
-							tmp = tmp->right;
-						}
-					}
-					this->_current = tmp;
-				}
+				this->_current = node_base::decrement( this->_current );
 				return ( *this );
 			}
 
-			//  (2) Operator-- : post-increment version  //
+			//  (2) Operator-- : post-decrement version  //
 			map_iterator	operator--( int )
 			{
 				map_iterator	tmp = *this;
@@ -783,45 +686,25 @@ namespace ft
 			//  Operator* : dereference iterator : returns a reference to element pointed to by iterator  //
 			T&	operator*( void ) const
 			{
-				return ( *( this->_current->couple ));
+				return ( static_cast< nodePtr >( this->_current )->couple );
 			}
 
 			//  Operator-> : dereference iterator, returns pointer to element pointed by iterator (to access one of its members)  //
 			T*	operator->( void ) const
 			{
-				return ( this->_current->couple );
+				return ( &static_cast< nodePtr >( this->_current )->couple );
 			}
 
 			//  Operator ==  //
 			bool	operator==( const map_iterator rhs ) const
 			{
-				if ( !this->_current || !rhs._current )
-				{
-					if ( !this->_current && !rhs._current )
-						return ( true );
-					return ( false );
-				}
-				else if ( this->_current == rhs._current )
-				{
-					return ( true );
-				}
-				return ( false );
+				return ( this->_current == rhs._current );
 			}
 
 			//  Operator !=  //
 			bool	operator!=( const map_iterator rhs ) const
 			{
-				if ( !this->_current || !rhs._current )
-				{
-					if ( !this->_current && !rhs._current )
-						return ( false );
-					return ( true );
-				}
-				if ( this->_current == rhs._current )
-				{
-					return ( false );
-				}
-				return ( true );
+				return ( this->_current != rhs._current );
 			}
 
 	}; /* class map_iterator */
@@ -836,7 +719,7 @@ namespace ft
 
 	//  Ref : https://en.cppreference.com/w/cpp/iterator/distance  //
 	template< class InputIterator >
-	typename iterator_traits< InputIterator >::difference_type __distance( InputIterator _first , InputIterator _last )
+	typename iterator_traits< InputIterator >::difference_type __distance( InputIterator _first , InputIterator _last , input_iterator_tag )
 	{
 		typename ft::iterator_traits< InputIterator >::difference_type	ret = 0;
 
@@ -860,6 +743,17 @@ namespace ft
 		return ( __distance( first , last , typename ft::iterator_traits< InputIterator >::iterator_category() ));
 	}
 
+	//  distance() : map iterators version, difference of the two ranks read from subtree sizes, O(log n)  //
+	template< class T >
+	typename map_iterator< T >::difference_type	distance( map_iterator< T > first , map_iterator< T > last )
+	{
+		typedef typename map_iterator< T >::difference_type	difference_type;
+
+		if ( first == last )
+			return ( 0 );
+		return ( static_cast< difference_type >( node_base::rank( last._current ) ) - static_cast< difference_type >( node_base::rank( first._current ) ) );
+	}
+
 } /* namespace ft */
 
 #endif /* IERATOR_HPP */
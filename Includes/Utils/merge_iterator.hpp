@@ -0,0 +1,282 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   merge_iterator.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:47:05 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 11:47:05 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MERGE_ITERATOR_HPP
+# define MERGE_ITERATOR_HPP
+
+# include <cstddef>
+
+# include "iterator.hpp"
+
+/*
+
+Merge iterator	--> input iterator walking two ranges sorted by the same 
+					strictly increasing keys at once, and yielding the 
+					elements of their union, intersection, difference, or 
+					the elements of the second range whose key is in both 
+					but whose mapped value changed. Every step moves one or 
+					both underlying iterators forward, so a full walk is 
+					O(n + m) and its output is sorted with unique keys : 
+					it feeds a sorted_unique bulk build directly.
+
+Unless otherwise indicated all refs come from :
+	https://en.cppreference.com/w/cpp/algorithm/set_union
+	https://en.cppreference.com/w/cpp/algorithm/set_intersection
+	https://en.cppreference.com/w/cpp/algorithm/set_difference
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 MERGE MODES												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	struct	merge_union_tag			{};		// keys in either range, the first range wins ties
+	struct	merge_intersection_tag	{};		// keys in both ranges, taken from the first
+	struct	merge_difference_tag	{};		// keys in the first range only
+	struct	merge_changed_tag		{};		// keys in both with different values, taken from the second
+
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 CLASS MERGE_ITERATOR										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Iterator , class Compare , class Mode >
+	class merge_iterator
+	{
+		public :
+
+			//  Members type  //
+			typedef ft::input_iterator_tag										iterator_category;
+			typedef typename ft::iterator_traits< Iterator >::value_type		value_type;
+			typedef typename ft::iterator_traits< Iterator >::difference_type	difference_type;
+			typedef typename ft::iterator_traits< Iterator >::pointer			pointer;
+			typedef typename ft::iterator_traits< Iterator >::reference			reference;
+
+		private :
+
+			//  Attributes  //
+			Iterator	_first1;	// next element of the first range
+			Iterator	_last1;
+			Iterator	_first2;	// next element of the second range
+			Iterator	_last2;
+			Compare		_comp;		// key comparison shared by both ranges
+			pointer		_current;	// element yielded, NULL once past-the-end
+			bool		_step1;		// operator++ moves _first1
+			bool		_step2;		// operator++ moves _first2
+
+		/* -------------------------------------------------------------------*/
+		/* 			 MEMBER FUNCTIONS 										  */
+		/* -------------------------------------------------------------------*/
+
+		public :
+
+			//  (1) Default constructor : past-the-end  //
+			merge_iterator( void ) : _first1() , _last1() , _first2() , _last2() , _comp() , \
+				_current( NULL ) , _step1( false ) , _step2( false )
+			{
+				return ;
+			}
+
+			//  (2) Range constructor : positioned on the first element of the result  //
+			//  merge_iterator( last1 , last1 , last2 , last2 , comp ) is the matching end  //
+			merge_iterator( Iterator first1 , Iterator last1 , Iterator first2 , Iterator last2 , const Compare& comp ) : \
+				_first1( first1 ) , _last1( last1 ) , _first2( first2 ) , _last2( last2 ) , _comp( comp ) , \
+				_current( NULL ) , _step1( false ) , _step2( false )
+			{
+				this->settle( Mode() );
+				return ;
+			}
+
+			//  (3) Copy constructor  //
+			merge_iterator( const merge_iterator& x ) : _first1( x._first1 ) , _last1( x._last1 ) , \
+				_first2( x._first2 ) , _last2( x._last2 ) , _comp( x._comp ) , _current( x._current ) , \
+				_step1( x._step1 ) , _step2( x._step2 )
+			{
+				return ;
+			}
+
+			//  Destructor  //
+			~merge_iterator( void )
+			{
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			merge_iterator	&operator=( const merge_iterator& rhs )
+			{
+				if ( this != &rhs )
+				{
+					this->_first1 = rhs._first1;
+					this->_last1 = rhs._last1;
+					this->_first2 = rhs._first2;
+					this->_last2 = rhs._last2;
+					this->_comp = rhs._comp;
+					this->_current = rhs._current;
+					this->_step1 = rhs._step1;
+					this->_step2 = rhs._step2;
+				}
+				return ( *this );
+			}
+
+			//  (1) Operator++ : pre-increment version, skips what the mode leaves out  //
+			merge_iterator&	operator++( void )
+			{
+				if ( this->_step1 )
+					++this->_first1;
+				if ( this->_step2 )
+					++this->_first2;
+				this->settle( Mode() );
+				return ( *this );
+			}
+
+			//  (2) Operator++ : post-increment version  //
+			merge_iterator	operator++( int )
+			{
+				merge_iterator	tmp = *this;
+
+				this->operator++();
+				return ( tmp );
+			}
+
+			//  Operator* : the element yielded, owned by one of the two ranges  //
+			reference	operator*( void ) const
+			{
+				return ( *this->_current );
+			}
+
+			//  Operator->  //
+			pointer		operator->( void ) const
+			{
+				return ( this->_current );
+			}
+
+			//  Operator == : elements are distinct objects, and every end iterator holds NULL  //
+			bool	operator==( const merge_iterator& rhs ) const
+			{
+				return ( this->_current == rhs._current );
+			}
+
+			//  Operator !=  //
+			bool	operator!=( const merge_iterator& rhs ) const
+			{
+				return ( this->_current != rhs._current );
+			}
+
+		private :
+
+			//  yield() : makes *it the current element and records which ranges operator++ moves  //
+			void	yield( Iterator it , bool step1 , bool step2 )
+			{
+				this->_current = &( *it );
+				this->_step1 = step1;
+				this->_step2 = step2;
+				return ;
+			}
+
+			//  finish() : both ranges are exhausted for this mode  //
+			void	finish( void )
+			{
+				this->_first1 = this->_last1;
+				this->_first2 = this->_last2;
+				this->_current = NULL;
+				this->_step1 = false;
+				this->_step2 = false;
+				return ;
+			}
+
+			//  (1) settle() : union, the smaller key comes first, equal keys step both ranges  //
+			void	settle( merge_union_tag )
+			{
+				if ( this->_first1 == this->_last1 && this->_first2 == this->_last2 )
+					this->finish();
+				else if ( this->_first1 == this->_last1 )
+					this->yield( this->_first2 , false , true );
+				else if ( this->_first2 == this->_last2 || this->_comp( ( *this->_first1 ).first , ( *this->_first2 ).first ) )
+					this->yield( this->_first1 , true , false );
+				else if ( this->_comp( ( *this->_first2 ).first , ( *this->_first1 ).first ) )
+					this->yield( this->_first2 , false , true );
+				else
+					this->yield( this->_first1 , true , true );
+				return ;
+			}
+
+			//  (2) settle() : intersection, moves the smaller key until both match  //
+			void	settle( merge_intersection_tag )
+			{
+				while ( this->_first1 != this->_last1 && this->_first2 != this->_last2 )
+				{
+					if ( this->_comp( ( *this->_first1 ).first , ( *this->_first2 ).first ) )
+						++this->_first1;
+					else if ( this->_comp( ( *this->_first2 ).first , ( *this->_first1 ).first ) )
+						++this->_first2;
+					else
+					{
+						this->yield( this->_first1 , true , true );
+						return ;
+					}
+				}
+				this->finish();
+				return ;
+			}
+
+			//  (3) settle() : difference, skips the keys of the first range found in the second  //
+			void	settle( merge_difference_tag )
+			{
+				while ( this->_first1 != this->_last1 )
+				{
+					if ( this->_first2 == this->_last2 || this->_comp( ( *this->_first1 ).first , ( *this->_first2 ).first ) )
+					{
+						this->yield( this->_first1 , true , false );
+						return ;
+					}
+					if ( !this->_comp( ( *this->_first2 ).first , ( *this->_first1 ).first ) )
+						++this->_first1;
+					++this->_first2;
+				}
+				this->finish();
+				return ;
+			}
+
+			//  (4) settle() : changed, intersection whose mapped values differ, the second range's value is yielded  //
+			void	settle( merge_changed_tag )
+			{
+				while ( this->_first1 != this->_last1 && this->_first2 != this->_last2 )
+				{
+					if ( this->_comp( ( *this->_first1 ).first , ( *this->_first2 ).first ) )
+						++this->_first1;
+					else if ( this->_comp( ( *this->_first2 ).first , ( *this->_first1 ).first ) )
+						++this->_first2;
+					else if ( ( *this->_first1 ).second == ( *this->_first2 ).second )
+					{
+						++this->_first1;
+						++this->_first2;
+					}
+					else
+					{
+						this->yield( this->_first2 , true , true );
+						return ;
+					}
+				}
+				this->finish();
+				return ;
+			}
+
+	}; /* class merge_iterator */
+
+} /* namespace ft */
+
+#endif /* MERGE_ITERATOR_HPP */
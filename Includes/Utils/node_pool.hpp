@@ -0,0 +1,417 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   node_pool.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:12:44 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/17 10:12:44 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef NODE_POOL_HPP
+# define NODE_POOL_HPP
+
+# include <cstddef>
+# include <memory>
+
+/*
+
+Node pool	--> slab allocator for fixed size objects (tree nodes) :
+				- memory is requested from Alloc by chunks (slabs) holding 
+				  many objects, each chunk twice as big as the previous one 
+				  up to max_chunk objects,
+				- deallocated objects are kept in two intrusive free lists 
+				  of about the same length (the link is written in the 
+				  freed object itself) and handed back first by allocate(),
+				- release() gives every chunk back to Alloc at once.
+			--> the pool only manages raw memory : constructing and 
+				destroying objects is left to the caller.
+			--> pools may share chunks, so trees can trade nodes without 
+				copying them ( split and join ) :
+				- every chunk links the previous one and counts the links 
+				  to it ( pools and newer chunks ), a chunk is given back 
+				  when its count drops to 0,
+				- share() makes an empty pool link the chunks of another : 
+				  both then prepend their own new chunks, the old ones 
+				  are never written again but for their count,
+				- share() also moves one free list, adopt() splices both 
+				  back : memory freed on one side of a split is reused by 
+				  the other side after the join,
+				- adopt() takes over the chunks of another pool : chunks 
+				  only that pool links go in front of this chain when both 
+				  lead to the same shared chunk, otherwise a link header 
+				  written in a free slot points at both chains.
+				Counts are atomic : pools sharing chunks may be used 
+				from different threads.
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 CLASS NODE_POOL											  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class T , class Alloc = std::allocator< T > >
+	class node_pool
+	{
+		public :
+
+		/* ------------------------------------------------------------------ */
+		/* 	Members types											   		  */
+		/* ------------------------------------------------------------------ */
+
+			typedef T									value_type;
+			typedef Alloc								allocator_type;
+			typedef typename allocator_type::pointer	pointer;
+			typedef typename allocator_type::size_type	size_type;
+
+		private :
+
+			//  free_slot : link written in a deallocated object  //
+			struct free_slot
+			{
+				free_slot*	next;
+			};
+
+			//  chunk_header : written in the first slots of every chunk, and in the link left by adopt()  //
+			struct chunk_header
+			{
+				pointer		next;		// previous chunk
+				pointer		kept;		// link only : last chunk of the adopted pool, NULL for a chunk
+				size_type	count;		// number of objects in this chunk (the last chunk's for a link)
+				size_type	refs;		// pools and headers pointing at this one
+			};
+
+			static const size_type	first_chunk	= 32;
+			static const size_type	max_chunk	= 4096;
+			static const size_type	header_slots = ( sizeof( chunk_header ) + sizeof( T ) - 1 ) / sizeof( T );
+
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												  	 	  */
+		/* ------------------------------------------------------------------ */
+
+			free_slot*		_free[2];	// free lists of deallocated objects, kept about the same length
+			free_slot*		_tail[2];	// last slot of each free list, for O(1) splicing
+			size_type		_count[2];	// length of each free list
+			pointer			_chunks;	// last allocated chunk
+			pointer			_next;		// next never used object in last chunk
+			pointer			_last;		// end of last chunk
+			allocator_type	_alloc;		// allocator giving chunks
+
+		public :
+
+		/* -------------------------------------------------------------------*/
+		/* 	Members functions												  */
+		/* -------------------------------------------------------------------*/
+
+			//  Constructor  //
+			explicit node_pool( const allocator_type& alloc = allocator_type() )
+				: _chunks( NULL ) , _next( NULL ) , _last( NULL ) , _alloc( alloc )
+			{
+				this->forget();
+				return ;
+			}
+
+			//  Destructor : chunks are only given back by release()  //
+			~node_pool( void )
+			{
+				return ;
+			}
+
+			//  allocate() : returns room for one object, from the free lists first, then from the last chunk  //
+			pointer	allocate( void )
+			{
+				pointer	ret = this->pop_free();
+
+				if ( ret )
+					return ( ret );
+				if ( this->_next == this->_last )
+					this->new_chunk();
+				ret = this->_next;
+				++this->_next;
+				return ( ret );
+			}
+
+			//  deallocate() : push room of one object on the shorter free list, so split() can give half of them away  //
+			void	deallocate( pointer p )
+			{
+				free_slot*	slot = reinterpret_cast< free_slot* >( p );
+				size_type	i = ( this->_count[0] > this->_count[1] );
+
+				slot->next = this->_free[i];
+				if ( !slot->next )
+					this->_tail[i] = slot;
+				this->_free[i] = slot;
+				++this->_count[i];
+				return ;
+			}
+
+			//  swap() : exchange chunks, free lists and allocators with x  //
+			void	swap( node_pool& x )
+			{
+				node_pool		tmp( this->_alloc );
+				allocator_type	tmp_alloc = this->_alloc;
+
+				tmp.take( *this );
+				this->take( x );
+				x.take( tmp );
+				this->_alloc = x._alloc;
+				x._alloc = tmp_alloc;
+				return ;
+			}
+
+			//  release() : give every chunk no other pool links back to the allocator, objects must have been destroyed before  //
+			void	release( void )
+			{
+				this->drop( this->_chunks );
+				this->forget();
+				return ;
+			}
+
+			//  share() : this empty pool keeps x's chunks alive too, objects allocated by x may now be deallocated here  //
+			//  Half of x's free objects move here : whichever side frees after a split refills the other side's  //
+			//  allocations once they are joined again, instead of the other side growing new chunks  //
+			void	share( node_pool& x )
+			{
+				size_type	i = ( x._count[1] > x._count[0] );
+
+				this->release();
+				this->_chunks = x._chunks;
+				if ( this->_chunks )
+					__sync_add_and_fetch( &header_of( this->_chunks )->refs , 1 );
+				this->_free[0] = x._free[i];
+				this->_tail[0] = x._tail[i];
+				this->_count[0] = x._count[i];
+				x._free[i] = NULL;
+				x._tail[i] = NULL;
+				x._count[i] = 0;
+				return ;
+			}
+
+			//  adopt() : take over x's chunks, free lists and unused chunk end, x is left empty  //
+			//  When both chains lead to the same shared chunk, the chunks only x links are put in front of this chain ;  //
+			//  otherwise a link pointing at both is written in a free slot (a chunk is only allocated when none is left)  //
+			void	adopt( node_pool& x )
+			{
+				pointer			x_shared;
+				pointer			x_last;
+				pointer			this_shared;
+				pointer			this_last;
+				size_type		shorter;
+				size_type		longer;
+				chunk_header*	header;
+
+				if ( !x._chunks )
+					return ;
+				if ( !this->_chunks )
+				{
+					this->swap( x );
+					return ;
+				}
+				if ( x.first_shared( x_shared , x_last ) && ( !x_shared || \
+					( this->first_shared( this_shared , this_last ) && x_shared == this_shared ) ) )
+				{
+					if ( x_last )
+					{
+						header_of( x_last )->next = this->_chunks;
+						this->_chunks = x._chunks;
+					}
+					this->drop( x_shared );
+				}
+				else
+				{
+					pointer	link = x.link_room();
+
+					if ( !link )
+						link = this->link_room();
+					if ( !link )
+					{
+						this->new_chunk();
+						link = this->link_room();
+					}
+					header = header_of( link );
+					header->next = this->_chunks;
+					header->kept = x._chunks;
+					header->count = header_of( this->_chunks )->count;
+					header->refs = 1;
+					this->_chunks = link;
+				}
+				shorter = ( this->_count[0] > this->_count[1] );
+				longer = ( x._count[0] < x._count[1] );
+				this->splice_free( x , shorter , longer );
+				this->splice_free( x , shorter ^ 1 , longer ^ 1 );
+				if ( this->_next == this->_last )
+				{
+					this->_next = x._next;
+					this->_last = x._last;
+				}
+				else
+					for ( ; x._next != x._last ; ++x._next )
+						this->deallocate( x._next );
+				x.forget();
+				return ;
+			}
+
+		private :
+
+			static const size_type	max_splice	= 16;	// exclusive chunks walked by first_shared()
+
+			//  Not copyable : two pools would give back the same chunks  //
+			node_pool( const node_pool& x );
+			node_pool&	operator=( const node_pool& x );
+
+			//  header_of() : header written at the start of chunk (or link)  //
+			static chunk_header*	header_of( pointer chunk )
+			{
+				return ( reinterpret_cast< chunk_header* >( chunk ) );
+			}
+
+			//  first_shared() : shared is the first chunk of the chain that another pool also links (NULL at the end of  //
+			//  the chain), last the chunk before it (NULL if none) : this pool alone links every chunk up to last  //
+			//  Returns false when more than max_splice chunks would have to be walked  //
+			bool	first_shared( pointer& shared , pointer& last ) const
+			{
+				size_type	walked = 0;
+
+				shared = this->_chunks;
+				last = NULL;
+				while ( shared && __sync_add_and_fetch( &header_of( shared )->refs , 0 ) == 1 )
+				{
+					if ( ++walked > max_splice )
+						return ( false );
+					last = shared;
+					shared = header_of( shared )->next;
+				}
+				return ( true );
+			}
+
+			//  drop() : remove one link to chunk, give it back when it was the last one and go on with what it linked  //
+			void	drop( pointer chunk )
+			{
+				chunk_header*	header;
+				pointer			next;
+
+				while ( chunk && __sync_sub_and_fetch( &header_of( chunk )->refs , 1 ) == 0 )
+				{
+					header = header_of( chunk );
+					next = header->next;
+					if ( header->kept )
+						this->drop( header->kept );		// a link lives in a slot of the chains it holds
+					else
+						this->_alloc.deallocate( chunk , header->count );
+					chunk = next;
+				}
+				return ;
+			}
+
+			//  take() : move x's chunks and free lists into this empty pool, allocators are left alone  //
+			void	take( node_pool& x )
+			{
+				this->_free[0] = x._free[0];
+				this->_free[1] = x._free[1];
+				this->_tail[0] = x._tail[0];
+				this->_tail[1] = x._tail[1];
+				this->_count[0] = x._count[0];
+				this->_count[1] = x._count[1];
+				this->_chunks = x._chunks;
+				this->_next = x._next;
+				this->_last = x._last;
+				x.forget();
+				return ;
+			}
+
+			//  forget() : empty pool, without touching the chunks  //
+			void	forget( void )
+			{
+				this->_free[0] = NULL;
+				this->_free[1] = NULL;
+				this->_tail[0] = NULL;
+				this->_tail[1] = NULL;
+				this->_count[0] = 0;
+				this->_count[1] = 0;
+				this->_chunks = NULL;
+				this->_next = NULL;
+				this->_last = NULL;
+				return ;
+			}
+
+			//  pop_free() : room of one deallocated object from the longer free list, NULL if both are empty  //
+			pointer	pop_free( void )
+			{
+				size_type	i = ( this->_count[1] > this->_count[0] );
+				free_slot*	slot = this->_free[i];
+
+				if ( !slot )
+					return ( NULL );
+				this->_free[i] = slot->next;
+				if ( !slot->next )
+					this->_tail[i] = NULL;
+				--this->_count[i];
+				return ( reinterpret_cast< pointer >( slot ) );
+			}
+
+			//  splice_free() : put x's free list from in front of this pool's list to, in O(1)  //
+			void	splice_free( node_pool& x , size_type to , size_type from )
+			{
+				if ( !x._free[from] )
+					return ;
+				x._tail[from]->next = this->_free[to];
+				if ( !this->_free[to] )
+					this->_tail[to] = x._tail[from];
+				this->_free[to] = x._free[from];
+				this->_count[to] += x._count[from];
+				x._free[from] = NULL;
+				x._tail[from] = NULL;
+				x._count[from] = 0;
+				return ;
+			}
+
+			//  link_room() : room for a link header, from a free list when one slot is enough or from the last chunk, NULL if none  //
+			pointer	link_room( void )
+			{
+				pointer	ret;
+
+				if ( header_slots == 1 && ( ret = this->pop_free() ) )
+					return ( ret );
+				if ( static_cast< size_type >( this->_last - this->_next ) < header_slots )
+					return ( NULL );
+				ret = this->_next;
+				this->_next += header_slots;
+				return ( ret );
+			}
+
+			//  new_chunk() : allocate a chunk twice as big as the last one (up to max_chunk objects)  //
+			void	new_chunk( void )
+			{
+				size_type		count = first_chunk;
+				pointer			chunk;
+				chunk_header*	header;
+
+				if ( this->_chunks )
+				{
+					count = header_of( this->_chunks )->count * 2;
+					if ( count > max_chunk )
+						count = max_chunk;
+				}
+				chunk = this->_alloc.allocate( count );
+				header = header_of( chunk );
+				header->next = this->_chunks;
+				header->kept = NULL;
+				header->count = count;
+				header->refs = 1;
+				this->_chunks = chunk;
+				this->_next = chunk + header_slots;
+				this->_last = chunk + count;
+				return ;
+			}
+
+	}; /* class node_pool */
+
+} /* namespace ft */
+
+#endif /* NODE_POOL_HPP */
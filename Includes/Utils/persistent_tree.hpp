@@ -0,0 +1,795 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   persistent_tree.hpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:12:40 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 18:41:22 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#ifndef PERSISTENT_TREE_HPP
+# define PERSISTENT_TREE_HPP
+
+# include <cstddef>
+# include <functional>
+# include <memory>
+# include <new>
+
+# include "utility.hpp"
+# include "iterator.hpp"
+
+/*
+
+Persistent Tree
+			--> AVL tree whose nodes may be shared between several versions 
+				of the tree. Copying a tree ( a snapshot ) only shares its 
+				root, O(1). Every node counts the pointers to it ( parents or 
+				tree roots ) :
+					- a write walks down its path and copies every node still 
+					  shared ( count > 1 ), the copy pointing to the same 
+					  children, whose count goes up ; nodes only this version 
+					  holds are modified in place,
+					- so a write after a snapshot copies O(log n) nodes, and 
+					  the next writes on the same path copy nothing,
+					- a node is destroyed when its count drops to 0.
+				Nodes have no parent pointer ( a node has several parents ), 
+				iterators keep the path from the root in a fixed size stack.
+				Counts are updated with atomic builtins : two trees sharing 
+				nodes can be used or destroyed from different threads, one 
+				tree object still belongs to one thread at a time.
+
+AVL Tree	--> self-balancing binary search tree : heights of the two 
+				subtrees of any node differ by at most one, so the height is 
+				under 1.45 * log2( n + 2 ).
+
+Unless otherwise indicated all refs come from :
+	Making Data Structures Persistent (Driscoll, Sarnak, Sleator, Tarjan), 1989
+	https://en.wikipedia.org/wiki/AVL_tree
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 STRUCT PERSISTENT_NODE										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T >
+	struct persistent_node
+	{
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												   	  	  */
+		/* ------------------------------------------------------------------ */
+
+		ft::pair< const Key , T >	couple;		// data node, stored inline
+		persistent_node*			left;		// left node
+		persistent_node*			right;		// right node
+		int							height;		// height of the subtree rooted here, 1 for a leaf
+		std::size_t					refs;		// pointers to this node (parents or tree roots), atomic
+
+		/* ------------------------------------------------------------------ */
+		/* 	Constructors											   	  	  */
+		/* ------------------------------------------------------------------ */
+
+		//  (1) One Constructor : new leaf, held by one pointer  //
+		persistent_node( const ft::pair< const Key , T >& val ) : couple( val ) , left( NULL ) , right( NULL ) , height( 1 ) , refs( 1 )
+		{
+			return ;
+		}
+
+		//  (2) Copy Constructor : same value and children, held by one pointer (children counts are raised by the tree)  //
+		persistent_node( const persistent_node& x ) : couple( x.couple ) , left( x.left ) , right( x.right ) , height( x.height ) , refs( 1 )
+		{
+			return ;
+		}
+
+		/* ------------------------------------------------------------------ */
+		/* 	Destructor												   		  */
+		/* ------------------------------------------------------------------ */
+
+		~persistent_node( void )
+		{
+			return ;
+		}
+
+	}; /* struct persistent_node */
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 PERSISTENT ITERATOR										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  path from the root to the current node, empty when past-the-end  //
+	template< class T , class Node >
+	class persistent_iterator
+	{
+		public :
+
+			//  Members type  //
+			typedef ft::bidirectional_iterator_tag	iterator_category;
+			typedef T								value_type;
+			typedef std::ptrdiff_t					difference_type;
+			typedef T*								pointer;
+			typedef T&								reference;
+
+			//  AVL height bound for 2^64 nodes  //
+			static const int	max_height = 96;
+
+			//  Attributes  //
+			Node*		_root;						// root of the version iterated
+			Node*		_path[ max_height ];		// nodes from the root to the current one
+			int			_depth;						// number of nodes in _path, 0 for end()
+
+		/* -------------------------------------------------------------------*/
+		/* 			 MEMBER FUNCTIONS 										  */
+		/* -------------------------------------------------------------------*/
+
+			//  (1) Default constructor  //
+			persistent_iterator( void ) : _root( NULL ) , _depth( 0 )
+			{
+				return ;
+			}
+
+			//  (2) End constructor  //
+			persistent_iterator( Node* root ) : _root( root ) , _depth( 0 )
+			{
+				return ;
+			}
+
+			//  (3) Copy constructor  //
+			persistent_iterator( const persistent_iterator& x ) : _root( x._root ) , _depth( x._depth )
+			{
+				for ( int i = 0 ; i < this->_depth ; ++i )
+					this->_path[ i ] = x._path[ i ];
+				return ;
+			}
+
+			//  Destructor  //
+			~persistent_iterator( void )
+			{
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			persistent_iterator&	operator=( const persistent_iterator& rhs )
+			{
+				this->_root = rhs._root;
+				this->_depth = rhs._depth;
+				for ( int i = 0 ; i < this->_depth ; ++i )
+					this->_path[ i ] = rhs._path[ i ];
+				return ( *this );
+			}
+
+			//  push() : append current to the path  //
+			void	push( Node* current )
+			{
+				this->_path[ this->_depth++ ] = current;
+				return ;
+			}
+
+			//  push_leftmost() : go down left from current, pushing every node  //
+			void	push_leftmost( Node* current )
+			{
+				for ( ; current ; current = current->left )
+					this->push( current );
+				return ;
+			}
+
+			//  push_rightmost() : go down right from current, pushing every node  //
+			void	push_rightmost( Node* current )
+			{
+				for ( ; current ; current = current->right )
+					this->push( current );
+				return ;
+			}
+
+			//  (1) Operator++ : pre-increment version, leftmost of the right subtree or first ancestor reached from its left  //
+			persistent_iterator&	operator++( void )
+			{
+				Node*	child = this->_path[ this->_depth - 1 ];
+
+				if ( child->right )
+				{
+					this->push_leftmost( child->right );
+					return ( *this );
+				}
+				while ( --this->_depth > 0 && this->_path[ this->_depth - 1 ]->right == child )
+					child = this->_path[ this->_depth - 1 ];
+				return ( *this );
+			}
+
+			//  (2) Operator++ : post-increment version  //
+			persistent_iterator	operator++( int )
+			{
+				persistent_iterator	tmp = *this;
+
+				this->operator++();
+				return ( tmp );
+			}
+
+			//  (1) Operator-- : pre-decrement version, end() goes to the biggest node  //
+			persistent_iterator&	operator--( void )
+			{
+				Node*	child;
+
+				if ( !this->_depth )
+				{
+					this->push_rightmost( this->_root );
+					return ( *this );
+				}
+				child = this->_path[ this->_depth - 1 ];
+				if ( child->left )
+				{
+					this->push_rightmost( child->left );
+					return ( *this );
+				}
+				while ( --this->_depth > 0 && this->_path[ this->_depth - 1 ]->left == child )
+					child = this->_path[ this->_depth - 1 ];
+				return ( *this );
+			}
+
+			//  (2) Operator-- : post-decrement version  //
+			persistent_iterator	operator--( int )
+			{
+				persistent_iterator	tmp = *this;
+
+				this->operator--();
+				return ( tmp );
+			}
+
+			//  Operator* : dereference iterator : returns a reference to element pointed to by iterator  //
+			T&	operator*( void ) const
+			{
+				return ( this->_path[ this->_depth - 1 ]->couple );
+			}
+
+			//  Operator-> : dereference iterator, returns pointer to element pointed by iterator  //
+			T*	operator->( void ) const
+			{
+				return ( &this->_path[ this->_depth - 1 ]->couple );
+			}
+
+			//  Operator == : same version and same node (both end() if no node)  //
+			bool	operator==( const persistent_iterator& rhs ) const
+			{
+				if ( !this->_depth || !rhs._depth )
+					return ( this->_depth == rhs._depth && this->_root == rhs._root );
+				return ( this->_path[ this->_depth - 1 ] == rhs._path[ rhs._depth - 1 ] );
+			}
+
+			//  Operator !=  //
+			bool	operator!=( const persistent_iterator& rhs ) const
+			{
+				return ( !( *this == rhs ) );
+			}
+
+	}; /* class persistent_iterator */
+
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 CLASS PERSISTENT_TREE										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Compare = std::less< Key > , class Alloc = std::allocator< ft::pair< const Key , T > > >
+	class persistent_tree
+	{
+		public :
+
+		/* ------------------------------------------------------------------ */
+		/* 	Members types											   		  */
+		/* ------------------------------------------------------------------ */
+
+			typedef	Key											key_type;
+			typedef	T											mapped_type;
+			typedef	ft::pair< const key_type , mapped_type >	value_type;
+			typedef	Compare										key_compare;
+			typedef	Alloc										allocator_type;
+			typedef typename allocator_type::size_type			size_type;
+			typedef persistent_node< Key , T >					node_type;
+			typedef node_type*									nodePtr;
+			typedef typename Alloc::template rebind< node_type >::other		nodeAlloc;
+			typedef persistent_iterator< const value_type , node_type >		const_iterator;
+
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												  	 	  */
+		/* ------------------------------------------------------------------ */
+
+			nodePtr		_root;		// root of this version, NULL if empty
+			size_type	_size;		// number of nodes in this version
+			Compare		_comp;		// key_compare
+			nodeAlloc	_alloc;		// node allocator
+
+		/* -------------------------------------------------------------------*/
+		/* 	Members functions												  */
+		/* -------------------------------------------------------------------*/
+
+			//  Constructor  //
+			persistent_tree( const key_compare& comp = key_compare() , const allocator_type& alloc = allocator_type() )
+				: _root( NULL ) , _size( 0 ) , _comp( comp ) , _alloc( alloc )
+			{
+				return ;
+			}
+
+			//  Copy constructor : O(1) snapshot, the root is shared  //
+			persistent_tree( const persistent_tree& x ) : _root( x._root ) , _size( x._size ) , _comp( x._comp ) , _alloc( x._alloc )
+			{
+				this->retain( this->_root );
+				return ;
+			}
+
+			//  Destructor : drop this version, nodes no other version holds are destroyed  //
+			~persistent_tree( void )
+			{
+				this->release( this->_root );
+				return ;
+			}
+
+			//  Operator '=' overload : O(1), share x root and drop the current one  //
+			persistent_tree&	operator=( const persistent_tree& x )
+			{
+				nodePtr	old = this->_root;
+
+				this->retain( x._root );
+				this->_root = x._root;
+				this->_size = x._size;
+				this->_comp = x._comp;
+				this->release( old );
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      NODES                          			  */
+			/* -------------------------------------------------------------- */
+
+			//  retain() : one more pointer to current  //
+			static void	retain( nodePtr current )
+			{
+				if ( current )
+					__sync_add_and_fetch( &current->refs , 1 );
+				return ;
+			}
+
+			//  release() : one pointer less to current, destroyed with the pointers it holds when none is left  //
+			void	release( nodePtr current )
+			{
+				if ( !current || __sync_sub_and_fetch( &current->refs , 1 ) != 0 )
+					return ;
+				this->release( current->left );
+				this->release( current->right );
+				this->_alloc.destroy( current );
+				this->_alloc.deallocate( current , 1 );
+				return ;
+			}
+
+			//  shared() : true if another pointer than the one followed leads to current  //
+			static bool	shared( nodePtr current )
+			{
+				return ( __sync_add_and_fetch( &current->refs , 0 ) != 1 );
+			}
+
+			//  new_node() : leaf holding a copy of val  //
+			nodePtr	new_node( const value_type& val )
+			{
+				nodePtr	ret = this->_alloc.allocate( 1 );
+
+				try
+				{
+					::new( static_cast< void* >( ret ) ) node_type( val );
+				}
+				catch ( ... )
+				{
+					this->_alloc.deallocate( ret , 1 );
+					throw ;
+				}
+				return ( ret );
+			}
+
+			//  own() : current, copied first if it is shared ; the copy holds the children too and takes slot's pointer  //
+			nodePtr	own( nodePtr& slot )
+			{
+				nodePtr	current = slot;
+				nodePtr	ret;
+
+				if ( !shared( current ) )
+					return ( current );
+				ret = this->_alloc.allocate( 1 );
+				try
+				{
+					::new( static_cast< void* >( ret ) ) node_type( *current );
+				}
+				catch ( ... )
+				{
+					this->_alloc.deallocate( ret , 1 );
+					throw ;
+				}
+				retain( ret->left );
+				retain( ret->right );
+				slot = ret;
+				this->release( current );
+				return ( ret );
+			}
+
+			//  descend() : nodes from the root down to key k in path, depth of them ; true if the last one holds k,  //
+			//  else k's leaf would hang under it  //
+			bool	descend( const key_type& k , nodePtr* path , int& depth ) const
+			{
+				nodePtr	current = this->_root;
+
+				depth = 0;
+				while ( current )
+				{
+					path[ depth++ ] = current;
+					if ( this->_comp( k , current->couple.first ) )
+						current = current->left;
+					else if ( this->_comp( current->couple.first , k ) )
+						current = current->right;
+					else
+						return ( true );
+				}
+				return ( false );
+			}
+
+			//  own_down() : owns path[0, depth[ from the root down, each copy taking the place of its node in path  //
+			void	own_down( nodePtr* path , int depth )
+			{
+				nodePtr*	slot = &this->_root;
+
+				for ( int i = 0 ; i < depth ; ++i )
+				{
+					path[ i ] = this->own( *slot );
+					if ( i + 1 < depth )
+						slot = ( path[ i ]->left == path[ i + 1 ] ) ? &path[ i ]->left : &path[ i ]->right;
+				}
+				return ;
+			}
+
+			//  link() : hangs a new node for val under path[depth - 1], the end of a descent that missed its key, then  //
+			//  rebalances up to the root ; path follows the rotations and ends with the new node, returns its length  //
+			//  An insert only rotates towards the new node : a single rotation at path[i] lifts path[i + 1] over it, a  //
+			//  double one lifts path[i + 2] over both, with the rest of the path under one of them  //
+			int	link( const value_type& val , nodePtr* path , int depth )
+			{
+				nodePtr	current;
+				nodePtr	top;
+
+				this->own_down( path , depth );
+				current = this->new_node( val );
+				if ( !depth )
+					this->_root = current;
+				else if ( this->_comp( val.first , path[ depth - 1 ]->couple.first ) )
+					path[ depth - 1 ]->left = current;
+				else
+					path[ depth - 1 ]->right = current;
+				path[ depth++ ] = current;
+				for ( int i = depth - 2 ; i >= 0 ; --i )
+				{
+					current = path[ i ];
+					top = this->rebalance( current );
+					if ( top == current )
+						continue ;
+					if ( !i )
+						this->_root = top;
+					else if ( path[ i - 1 ]->left == current )
+						path[ i - 1 ]->left = top;
+					else
+						path[ i - 1 ]->right = top;
+					if ( top == path[ i + 1 ] )
+					{
+						for ( int j = i ; j + 1 < depth ; ++j )
+							path[ j ] = path[ j + 1 ];
+						--depth;
+					}
+					else if ( i + 3 == depth )
+					{
+						path[ i ] = top;
+						depth = i + 1;
+					}
+					else
+					{
+						if ( path[ i + 1 ]->left != path[ i + 3 ] && path[ i + 1 ]->right != path[ i + 3 ] )
+							path[ i + 1 ] = current;
+						path[ i ] = top;
+						for ( int j = i + 2 ; j + 1 < depth ; ++j )
+							path[ j ] = path[ j + 1 ];
+						--depth;
+					}
+				}
+				return ( depth );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      BALANCING                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  height() : height of a subtree, 0 for a NULL leaf  //
+			static int	height( nodePtr current )
+			{
+				return ( ( current ) ? current->height : 0 );
+			}
+
+			//  update() : height of an owned node from its children  //
+			static void	update( nodePtr current )
+			{
+				int	left = height( current->left );
+				int	right = height( current->right );
+
+				current->height = ( ( left > right ) ? left : right ) + 1;
+				return ;
+			}
+
+			//  rotate_left() : right child of owned current takes its place, returns it  //
+			nodePtr	rotate_left( nodePtr current )
+			{
+				nodePtr	pivot = this->own( current->right );
+
+				current->right = pivot->left;
+				pivot->left = current;
+				update( current );
+				update( pivot );
+				return ( pivot );
+			}
+
+			//  rotate_right() : left child of owned current takes its place, returns it  //
+			nodePtr	rotate_right( nodePtr current )
+			{
+				nodePtr	pivot = this->own( current->left );
+
+				current->left = pivot->right;
+				pivot->right = current;
+				update( current );
+				update( pivot );
+				return ( pivot );
+			}
+
+			//  rebalance() : restore AVL balance at owned current after one of its subtrees changed height by one  //
+			nodePtr	rebalance( nodePtr current )
+			{
+				int	balance;
+
+				update( current );
+				balance = height( current->left ) - height( current->right );
+				if ( balance > 1 )
+				{
+					if ( height( current->left->left ) < height( current->left->right ) )
+						current->left = this->rotate_left( this->own( current->left ) );
+					return ( this->rotate_right( current ) );
+				}
+				if ( balance < -1 )
+				{
+					if ( height( current->right->right ) < height( current->right->left ) )
+						current->right = this->rotate_right( this->own( current->right ) );
+					return ( this->rotate_left( current ) );
+				}
+				return ( current );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      MODIFIERS                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  insert() : iterator to the element with val's key, val inserted first if the key is not there yet  //
+			//  One descent : a key already there owns nothing, a new node owns its path only  //
+			ft::pair< const_iterator , bool >	insert( const value_type& val )
+			{
+				const_iterator	ret( this->_root );
+
+				if ( this->descend( val.first , ret._path , ret._depth ) )
+					return ( ft::pair< const_iterator , bool >( ret , false ) );
+				ret._depth = this->link( val , ret._path , ret._depth );
+				ret._root = this->_root;
+				++this->_size;
+				return ( ft::pair< const_iterator , bool >( ret , true ) );
+			}
+
+			//  own_node() : node with key k, inserted with a default mapped value if missing, owned down from the root  //
+			//  so its mapped value can be written ; one descent  //
+			nodePtr	own_node( const key_type& k )
+			{
+				nodePtr	path[ const_iterator::max_height ];
+				int		depth = 0;
+
+				if ( this->descend( k , path , depth ) )
+				{
+					this->own_down( path , depth );
+					return ( path[ depth - 1 ] );
+				}
+				depth = this->link( value_type( k , mapped_type() ) , path , depth );
+				++this->_size;
+				return ( path[ depth - 1 ] );
+			}
+
+			//  erase() : erase node with key k, return true if something is erased  //
+			bool	erase( const key_type& k )
+			{
+				if ( !this->find_node( k ) )
+					return ( false );
+				this->erase_node( this->_root , k );
+				--this->_size;
+				return ( true );
+			}
+
+			//  erase_node() : erase key k (present) under slot, the successor of a node with two children takes its place  //
+			void	erase_node( nodePtr& slot , const key_type& k )
+			{
+				nodePtr	current = this->own( slot );
+				nodePtr	next;
+
+				if ( this->_comp( k , current->couple.first ) )
+					this->erase_node( current->left , k );
+				else if ( this->_comp( current->couple.first , k ) )
+					this->erase_node( current->right , k );
+				else
+				{
+					if ( !current->left || !current->right )
+						slot = ( current->left ) ? current->left : current->right;
+					else
+					{
+						next = this->extract_min( current->right );
+						next->left = current->left;
+						next->right = current->right;
+						slot = this->rebalance( next );
+					}
+					current->left = NULL;
+					current->right = NULL;
+					this->release( current );
+					return ;
+				}
+				slot = this->rebalance( current );
+				return ;
+			}
+
+			//  extract_min() : unlink the smallest node under slot and return it, owned, slot rebalanced  //
+			nodePtr	extract_min( nodePtr& slot )
+			{
+				nodePtr	current = this->own( slot );
+				nodePtr	ret;
+
+				if ( !current->left )
+				{
+					slot = current->right;
+					current->right = NULL;
+					return ( current );
+				}
+				ret = this->extract_min( current->left );
+				slot = this->rebalance( current );
+				return ( ret );
+			}
+
+			//  clear() : drop this version  //
+			void	clear( void )
+			{
+				this->release( this->_root );
+				this->_root = NULL;
+				this->_size = 0;
+				return ;
+			}
+
+			//  swap() : exchange versions with x, O(1)  //
+			void	swap( persistent_tree& x )
+			{
+				nodePtr		tmp_root	= this->_root;
+				size_type	tmp_size	= this->_size;
+				Compare		tmp_comp	= this->_comp;
+				nodeAlloc	tmp_alloc	= this->_alloc;
+
+				this->_root = x._root;
+				this->_size = x._size;
+				this->_comp = x._comp;
+				this->_alloc = x._alloc;
+				x._root = tmp_root;
+				x._size = tmp_size;
+				x._comp = tmp_comp;
+				x._alloc = tmp_alloc;
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      FIND                           			  */
+			/* -------------------------------------------------------------- */
+
+			//  find_node() : node with key k, NULL if none  //
+			nodePtr	find_node( const key_type& k ) const
+			{
+				nodePtr	current = this->_root;
+
+				while ( current )
+				{
+					if ( this->_comp( k , current->couple.first ) )
+						current = current->left;
+					else if ( this->_comp( current->couple.first , k ) )
+						current = current->right;
+					else
+						return ( current );
+				}
+				return ( NULL );
+			}
+
+			//  begin() : path down to the smallest node  //
+			const_iterator	begin( void ) const
+			{
+				const_iterator	ret( this->_root );
+
+				ret.push_leftmost( this->_root );
+				return ( ret );
+			}
+
+			//  end() : empty path  //
+			const_iterator	end( void ) const
+			{
+				return ( const_iterator( this->_root ) );
+			}
+
+			//  find() : path down to key k, end() if none  //
+			const_iterator	find( const key_type& k ) const
+			{
+				const_iterator	ret( this->_root );
+				nodePtr			current = this->_root;
+
+				while ( current )
+				{
+					ret.push( current );
+					if ( this->_comp( k , current->couple.first ) )
+						current = current->left;
+					else if ( this->_comp( current->couple.first , k ) )
+						current = current->right;
+					else
+						return ( ret );
+				}
+				return ( this->end() );
+			}
+
+			//  lower_bound() : path down to the first node whose key does not go before k, cut at the last candidate  //
+			const_iterator	lower_bound( const key_type& k ) const
+			{
+				const_iterator	ret( this->_root );
+				nodePtr			current = this->_root;
+				int				depth = 0;
+
+				while ( current )
+				{
+					ret.push( current );
+					if ( !this->_comp( current->couple.first , k ) )
+					{
+						depth = ret._depth;
+						current = current->left;
+					}
+					else
+						current = current->right;
+				}
+				ret._depth = depth;
+				return ( ret );
+			}
+
+			//  upper_bound() : path down to the first node whose key goes after k, cut at the last candidate  //
+			const_iterator	upper_bound( const key_type& k ) const
+			{
+				const_iterator	ret( this->_root );
+				nodePtr			current = this->_root;
+				int				depth = 0;
+
+				while ( current )
+				{
+					ret.push( current );
+					if ( this->_comp( k , current->couple.first ) )
+					{
+						depth = ret._depth;
+						current = current->left;
+					}
+					else
+						current = current->right;
+				}
+				ret._depth = depth;
+				return ( ret );
+			}
+
+	}; /* class persistent_tree */
+
+} /* namespace ft */
+
+#endif /* PERSISTENT_TREE_HPP */
@@ -0,0 +1,614 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   robin_hood_table.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:48:31 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 19:04:55 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ROBIN_HOOD_TABLE_HPP
+# define ROBIN_HOOD_TABLE_HPP
+
+# include <cstddef>
+# include <functional>
+# include <memory>
+# include <new>
+# include <stdexcept>
+
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "type_traits.hpp"
+# include "hash.hpp"
+
+/*
+
+Robin Hood Table
+			--> open addressing hash table, values stored inline in one 
+				array of slots, linear probing :
+					- a value goes to the slot its hash picks ( its home ) 
+					  or to the next free ones ; one byte per slot keeps its 
+					  distance to home plus one, 0 for an empty slot,
+					- robin hood : an insert takes the slot of the first value 
+					  closer to its home than the new one would be, that value 
+					  and the ones after it shift by one slot. Values stay 
+					  sorted by home, probe lengths stay short and even, and 
+					  a lookup stops at the first value closer to its home,
+					- backward shift deletion : values after an erased one 
+					  come back one slot until one is at home, no tombstone,
+					- no wrap around : past the last home slot come 
+					  min( homes , 255 ) overflow slots, then a sentinel byte 
+					  that ends iterations ; a probe running out of room 
+					  grows the table, unless 255 keys share the same hash : 
+					  growing cannot split them, insert() throws 
+					  std::length_error.
+				Homes are a power of two, picked from the mixed hash low bits.
+				Inserts and erases move values : they invalidate iterators 
+				and references. Should a copy throw while values shift, 
+				insert() puts them back and the table is as before, erase() 
+				may also lose the value that could not move back ; no run 
+				is ever left with a hole.
+
+Unless otherwise indicated all refs come from :
+	Robin Hood Hashing (Celis), 1986
+	https://programming.guide/robin-hood-hashing.html
+	https://github.com/martinus/robin-hood-hashing
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 ROBIN HOOD ITERATOR										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  Slot and distance byte walked together, the sentinel byte stops the walk  //
+	template< class T >
+	class robin_hood_iterator
+	{
+		public :
+
+			//  Members type  //
+			typedef ft::forward_iterator_tag	iterator_category;
+			typedef T							value_type;
+			typedef std::ptrdiff_t				difference_type;
+			typedef T*							pointer;
+			typedef T&							reference;
+
+			//  Attributes  //
+			T*						_slot;		// current slot
+			const unsigned char*	_dist;		// current distance byte
+
+		/* -------------------------------------------------------------------*/
+		/* 			 MEMBER FUNCTIONS 										  */
+		/* -------------------------------------------------------------------*/
+
+			//  (1) Default constructor  //
+			robin_hood_iterator( void ) : _slot( NULL ) , _dist( NULL )
+			{
+				return ;
+			}
+
+			//  (2) Position constructor : slot must be full or the sentinel  //
+			robin_hood_iterator( T* slot , const unsigned char* dist ) : _slot( slot ) , _dist( dist )
+			{
+				return ;
+			}
+
+			//  (3) Copy constructor  //
+			robin_hood_iterator( const robin_hood_iterator< typename remove_const< T >::type >& x ) : _slot( x._slot ) , _dist( x._dist )
+			{
+				return ;
+			}
+
+			//  Destructor  //
+			~robin_hood_iterator( void )
+			{
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			robin_hood_iterator&	operator=( const robin_hood_iterator& rhs )
+			{
+				this->_slot = rhs._slot;
+				this->_dist = rhs._dist;
+				return ( *this );
+			}
+
+			//  skip() : moves to the first full slot from the current one on  //
+			robin_hood_iterator&	skip( void )
+			{
+				while ( !*this->_dist )
+				{
+					++this->_slot;
+					++this->_dist;
+				}
+				return ( *this );
+			}
+
+			//  (1) Operator++ : pre-increment version  //
+			robin_hood_iterator&	operator++( void )
+			{
+				++this->_slot;
+				++this->_dist;
+				return ( this->skip() );
+			}
+
+			//  (2) Operator++ : post-increment version  //
+			robin_hood_iterator	operator++( int )
+			{
+				robin_hood_iterator	tmp = *this;
+
+				this->operator++();
+				return ( tmp );
+			}
+
+			//  Operator* : dereference iterator : returns a reference to element pointed to by iterator  //
+			T&	operator*( void ) const
+			{
+				return ( *this->_slot );
+			}
+
+			//  Operator-> : dereference iterator, returns pointer to element pointed by iterator  //
+			T*	operator->( void ) const
+			{
+				return ( this->_slot );
+			}
+
+	}; /* class robin_hood_iterator */
+
+	//  (1) Operator == : mixed const / non const  //
+	template< class T , class U >
+	bool	operator==( const robin_hood_iterator< T >& lhs , const robin_hood_iterator< U >& rhs )
+	{
+		return ( lhs._dist == rhs._dist );
+	}
+
+	//  (2) Operator !=  //
+	template< class T , class U >
+	bool	operator!=( const robin_hood_iterator< T >& lhs , const robin_hood_iterator< U >& rhs )
+	{
+		return ( lhs._dist != rhs._dist );
+	}
+
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 CLASS ROBIN_HOOD_TABLE										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Hash = ft::hash< Key > , class KeyEqual = std::equal_to< Key > , \
+			class Alloc = std::allocator< ft::pair< const Key , T > > >
+	class robin_hood_table
+	{
+		public :
+
+		/* ------------------------------------------------------------------ */
+		/* 	Members types											   		  */
+		/* ------------------------------------------------------------------ */
+
+			typedef	Key											key_type;
+			typedef	T											mapped_type;
+			typedef	ft::pair< const key_type , mapped_type >	value_type;
+			typedef	Hash										hasher;
+			typedef	KeyEqual									key_equal;
+			typedef	Alloc										allocator_type;
+			typedef typename allocator_type::size_type			size_type;
+			typedef robin_hood_iterator< value_type >			iterator;
+			typedef robin_hood_iterator< const value_type >		const_iterator;
+			typedef typename Alloc::template rebind< unsigned char >::other	byteAlloc;
+
+			static const size_type		min_homes = 8;
+			static const unsigned char	max_dist = 255;
+
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												  	 	  */
+		/* ------------------------------------------------------------------ */
+
+			value_type*		_slots;		// homes + overflow slots, NULL before the first insert
+			unsigned char*	_dist;		// distance to home + 1 per slot, 0 if empty, then the sentinel
+			size_type		_homes;		// slots a hash may pick, a power of two ( 0 before the first insert )
+			size_type		_total;		// homes + overflow slots
+			size_type		_size;		// values stored
+			float			_max_load;	// size / homes never goes over it
+			Hash			_hash;		// hasher
+			KeyEqual		_eq;		// key_equal
+			Alloc			_alloc;		// slot allocator
+			byteAlloc		_bytes;		// distance bytes allocator
+
+		/* -------------------------------------------------------------------*/
+		/* 	Members functions												  */
+		/* -------------------------------------------------------------------*/
+
+			//  Constructor : homes for n values without growing  //
+			robin_hood_table( size_type n = 0 , const hasher& hf = hasher() , const key_equal& eq = key_equal() , const allocator_type& alloc = allocator_type() )
+				: _slots( NULL ) , _dist( NULL ) , _homes( 0 ) , _total( 0 ) , _size( 0 ) , _max_load( 0.8f ) , _hash( hf ) , _eq( eq ) , \
+				_alloc( alloc ) , _bytes( alloc )
+			{
+				if ( n )
+					this->rehash( this->homes_for( n ) );
+				return ;
+			}
+
+			//  Copy constructor : slot for slot, no hashing  //
+			robin_hood_table( const robin_hood_table& x ) : _slots( NULL ) , _dist( NULL ) , _homes( 0 ) , _total( 0 ) , _size( 0 ) , \
+				_max_load( x._max_load ) , _hash( x._hash ) , _eq( x._eq ) , _alloc( x._alloc ) , _bytes( x._bytes )
+			{
+				this->assign( x );
+				return ;
+			}
+
+			//  Destructor  //
+			~robin_hood_table( void )
+			{
+				this->clear();
+				this->deallocate();
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			robin_hood_table&	operator=( const robin_hood_table& x )
+			{
+				if ( this != &x )
+				{
+					this->_max_load = x._max_load;
+					this->_hash = x._hash;
+					this->_eq = x._eq;
+					this->assign( x );
+				}
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      ITERATORS                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  begin() : first full slot  //
+			iterator	begin( void )
+			{
+				if ( !this->_homes )
+					return ( iterator() );
+				return ( iterator( this->_slots , this->_dist ).skip() );
+			}
+
+			//  const begin()  //
+			const_iterator	begin( void ) const
+			{
+				if ( !this->_homes )
+					return ( const_iterator() );
+				return ( const_iterator( this->_slots , this->_dist ).skip() );
+			}
+
+			//  end() : the sentinel  //
+			iterator	end( void )
+			{
+				return ( iterator( this->_slots + this->_total , this->_dist + this->_total ) );
+			}
+
+			//  const end()  //
+			const_iterator	end( void ) const
+			{
+				return ( const_iterator( this->_slots + this->_total , this->_dist + this->_total ) );
+			}
+
+			//  at() : iterator on slot i  //
+			iterator	at( size_type i )
+			{
+				return ( iterator( this->_slots + i , this->_dist + i ) );
+			}
+
+			//  end_slot() : index past the last slot, what find_slot() returns for a missing key  //
+			size_type	end_slot( void ) const
+			{
+				return ( this->_total );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      LOOKUP                         			  */
+			/* -------------------------------------------------------------- */
+
+			//  home() : home slot of key k  //
+			size_type	home( const key_type& k ) const
+			{
+				return ( ft::hash_mix( this->_hash( k ) ) & ( this->_homes - 1 ) );
+			}
+
+			//  find_slot() : slot holding key k, _total if none ; stops at the first value closer to its home than k would be  //
+			size_type	find_slot( const key_type& k ) const
+			{
+				size_type		i;
+				unsigned int	dist = 1;
+
+				if ( !this->_size )
+					return ( this->_total );
+				for ( i = this->home( k ) ; this->_dist[ i ] >= dist ; ++i , ++dist )
+				{
+					if ( this->_dist[ i ] == dist && this->_eq( this->_slots[ i ].first , k ) )
+						return ( i );
+				}
+				return ( this->_total );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      MODIFIERS                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  insert() : slot of val key, val is copied in first if the key is not there yet ; a full table grows only for a new key  //
+			//  The run from the insertion slot up to the next empty one shifts right ; a distance over 255 or a run  //
+			//  reaching the sentinel grows the table and starts again, length_error if the key's hash is already  //
+			//  held by max_dist - 1 keys, which no table size can spread  //
+			ft::pair< size_type , bool >	insert( const value_type& val )
+			{
+				size_type		i;
+				size_type		empty;
+				unsigned int	dist;
+
+				if ( this->_size + 1 > this->capacity() )
+				{
+					if ( ( i = this->find_slot( val.first ) ) != this->_total )
+						return ( ft::pair< size_type , bool >( i , false ) );
+					this->rehash( this->_homes ? this->_homes * 2 : min_homes );
+				}
+				while ( true )
+				{
+					for ( i = this->home( val.first ) , dist = 1 ; this->_dist[ i ] >= dist ; ++i , ++dist )
+					{
+						if ( this->_dist[ i ] == dist && this->_eq( this->_slots[ i ].first , val.first ) )
+							return ( ft::pair< size_type , bool >( i , false ) );
+					}
+					for ( empty = i ; empty < this->_total && this->_dist[ empty ] && this->_dist[ empty ] < max_dist ; ++empty )
+						;
+					if ( i < this->_total && dist < max_dist && empty < this->_total && !this->_dist[ empty ] )
+						break ;
+					if ( dist >= max_dist && this->same_hash( val.first ) + 1 >= max_dist )
+						throw ( std::length_error( "ft::robin_hood_table::insert" ) );
+					this->rehash( this->_homes * 2 );
+				}
+				//  A throwing copy leaves slot empty without a value : the values already shifted come back over it  //
+				try
+				{
+					for ( ; empty > i ; --empty )
+					{
+						this->_alloc.construct( this->_slots + empty , this->_slots[ empty - 1 ] );
+						this->_alloc.destroy( this->_slots + empty - 1 );
+						this->_dist[ empty ] = this->_dist[ empty - 1 ] + 1;
+						this->_dist[ empty - 1 ] = 0;
+					}
+					this->_alloc.construct( this->_slots + i , val );
+				}
+				catch ( ... )
+				{
+					this->close_hole( empty );
+					throw ;
+				}
+				this->_dist[ i ] = static_cast< unsigned char >( dist );
+				++this->_size;
+				return ( ft::pair< size_type , bool >( i , true ) );
+			}
+
+			//  erase_slot() : destroys the value of slot i, the values after it come back one slot until one is at home  //
+			void	erase_slot( size_type i )
+			{
+				this->_alloc.destroy( this->_slots + i );
+				--this->_size;
+				this->close_hole( i );
+				return ;
+			}
+
+			//  clear() : destroys every value, slots are kept  //
+			void	clear( void )
+			{
+				for ( size_type i = 0 ; this->_size ; ++i )
+				{
+					if ( this->_dist[ i ] )
+					{
+						this->_alloc.destroy( this->_slots + i );
+						this->_dist[ i ] = 0;
+						--this->_size;
+					}
+				}
+				return ;
+			}
+
+			//  swap() : exchanges tables with x, O(1)  //
+			void	swap( robin_hood_table& x )
+			{
+				robin_hood_table	tmp( 0 , x._hash , x._eq , x._alloc );
+
+				tmp.steal( x );
+				x.steal( *this );
+				this->steal( tmp );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      HASH POLICY                    			  */
+			/* -------------------------------------------------------------- */
+
+			//  capacity() : values storable before the table grows  //
+			size_type	capacity( void ) const
+			{
+				return ( static_cast< size_type >( this->_homes * this->_max_load ) );
+			}
+
+			//  homes_for() : power of two homes keeping n values under the max load factor  //
+			size_type	homes_for( size_type n ) const
+			{
+				size_type	ret = min_homes;
+
+				while ( static_cast< size_type >( ret * this->_max_load ) < n )
+					ret *= 2;
+				return ( ret );
+			}
+
+			//  max_load_factor() : sets the load factor the table grows at, growing now if it is already over  //
+			//  invalid_argument unless ml is positive : homes_for() could never reach a capacity  //
+			void	max_load_factor( float ml )
+			{
+				if ( !( ml > 0 ) )
+					throw ( std::invalid_argument( "ft::robin_hood_table::max_load_factor" ) );
+				this->_max_load = ml;
+				if ( this->_size > this->capacity() )
+					this->rehash( this->homes_for( this->_size ) );
+				return ;
+			}
+
+			//  rehash() : moves every value to a table of at least n homes ( and enough for size() ), rounded to a power of two  //
+			void	rehash( size_type n )
+			{
+				robin_hood_table	tmp( 0 , this->_hash , this->_eq , this->_alloc );
+				size_type			homes = this->homes_for( this->_size );
+
+				while ( homes < n )
+					homes *= 2;
+				if ( homes == this->_homes )
+					return ;
+				tmp._max_load = this->_max_load;
+				tmp.allocate( homes );
+				for ( size_type i = 0 ; i < this->_total ; ++i )
+				{
+					if ( this->_dist[ i ] )
+						tmp.insert( this->_slots[ i ] );
+				}
+				this->swap( tmp );
+				return ;
+			}
+
+		private :
+
+			//  close_hole() : slot i holds no value, the values after it come back one slot until one is at home  //
+			//  A hole left in a run would end every probe going through it : should a copy throw, the value that  //
+			//  could not come back is dropped, and both holes close up before the exception goes on  //
+			void	close_hole( size_type i )
+			{
+				for ( ; i + 1 < this->_total && this->_dist[ i + 1 ] > 1 ; ++i )
+				{
+					try
+					{
+						this->_alloc.construct( this->_slots + i , this->_slots[ i + 1 ] );
+					}
+					catch ( ... )
+					{
+						this->_alloc.destroy( this->_slots + i + 1 );
+						--this->_size;
+						try
+						{
+							this->close_hole( i + 1 );
+						}
+						catch ( ... )
+						{
+							this->close_hole( i );
+							throw ;
+						}
+						this->close_hole( i );
+						throw ;
+					}
+					this->_alloc.destroy( this->_slots + i + 1 );
+					this->_dist[ i ] = this->_dist[ i + 1 ] - 1;
+				}
+				this->_dist[ i ] = 0;
+				return ;
+			}
+
+			//  same_hash() : number of values in the run starting at k's home whose hash equals k's  //
+			size_type	same_hash( const key_type& k ) const
+			{
+				std::size_t	h = this->_hash( k );
+				size_type	ret = 0;
+
+				for ( size_type i = this->home( k ) ; i < this->_total && this->_dist[ i ] ; ++i )
+					ret += ( this->_hash( this->_slots[ i ].first ) == h );
+				return ( ret );
+			}
+
+			//  allocate() : empty table of homes slots plus overflow, sentinel set  //
+			void	allocate( size_type homes )
+			{
+				size_type	total = homes + ( ( homes < max_dist ) ? homes : max_dist );
+
+				this->_slots = this->_alloc.allocate( total );
+				try
+				{
+					this->_dist = this->_bytes.allocate( total + 1 );
+				}
+				catch ( ... )
+				{
+					this->_alloc.deallocate( this->_slots , total );
+					this->_slots = NULL;
+					throw ;
+				}
+				for ( size_type i = 0 ; i < total ; ++i )
+					this->_dist[ i ] = 0;
+				this->_dist[ total ] = 1;
+				this->_homes = homes;
+				this->_total = total;
+				return ;
+			}
+
+			//  deallocate() : frees the slots of an empty table  //
+			void	deallocate( void )
+			{
+				if ( !this->_homes )
+					return ;
+				this->_alloc.deallocate( this->_slots , this->_total );
+				this->_bytes.deallocate( this->_dist , this->_total + 1 );
+				this->_slots = NULL;
+				this->_dist = NULL;
+				this->_homes = 0;
+				this->_total = 0;
+				return ;
+			}
+
+			//  steal() : takes x table, leaving x without one  //
+			void	steal( robin_hood_table& x )
+			{
+				this->_slots = x._slots;
+				this->_dist = x._dist;
+				this->_homes = x._homes;
+				this->_total = x._total;
+				this->_size = x._size;
+				this->_max_load = x._max_load;
+				this->_hash = x._hash;
+				this->_eq = x._eq;
+				this->_alloc = x._alloc;
+				this->_bytes = x._bytes;
+				x._slots = NULL;
+				x._dist = NULL;
+				x._homes = 0;
+				x._total = 0;
+				x._size = 0;
+				return ;
+			}
+
+			//  assign() : copy of x slot for slot, same homes  //
+			void	assign( const robin_hood_table& x )
+			{
+				this->clear();
+				if ( this->_homes != x._homes )
+				{
+					this->deallocate();
+					if ( x._homes )
+						this->allocate( x._homes );
+				}
+				for ( size_type i = 0 ; i < x._total ; ++i )
+				{
+					if ( x._dist[ i ] )
+					{
+						this->_alloc.construct( this->_slots + i , x._slots[ i ] );
+						this->_dist[ i ] = x._dist[ i ];
+						++this->_size;
+					}
+				}
+				return ;
+			}
+
+	}; /* class robin_hood_table */
+
+} /* namespace ft */
+
+#endif /* ROBIN_HOOD_TABLE_HPP */
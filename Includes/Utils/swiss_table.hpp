@@ -0,0 +1,700 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   swiss_table.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:05:12 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 19:04:55 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SWISS_TABLE_HPP
+# define SWISS_TABLE_HPP
+
+# include <cstddef>
+# include <functional>
+# include <memory>
+# include <new>
+
+# if defined( __SSE2__ )
+#  include <emmintrin.h>
+# endif
+
+# include "utility.hpp"
+# include "iterator.hpp"
+# include "type_traits.hpp"
+# include "hash.hpp"
+
+/*
+
+Swiss Table	--> open addressing hash table whose slots each have one control 
+				byte, kept in a separate array :
+					- empty ( 0x80 ), deleted ( 0xFE ), sentinel ( 0xFF, ends 
+					  iterations ), or full : the 7 low bits of the hash ( H2 ),
+					- the other hash bits ( H1 ) pick where the probe starts, it 
+					  then reads groups of 16 control bytes with a triangular 
+					  step, and one compare gives the slots of a group whose H2 
+					  matches : only those keys are compared, about one in 128 
+					  of the others on a miss,
+					- a probe stops at the first group holding an empty byte,
+					- an erase leaves an empty byte if no probe can have gone 
+					  through the slot's group, a deleted one otherwise.
+				With SSE2 a group is one 16 bytes compare and a movemask, 
+				other targets build the same bit mask byte by byte. Capacities 
+				are 2^k - 1, 7/8 of the slots may be filled ( deleted ones 
+				included ) before the table is rebuilt. The first 15 control 
+				bytes are cloned after the sentinel, so a group read near the 
+				end needs no wrap around.
+				Inserts may rebuild the table : they invalidate iterators and 
+				references. Erases move nothing.
+
+Unless otherwise indicated all refs come from :
+	https://abseil.io/about/design/swisstables
+	https://www.youtube.com/watch?v=ncHmEUmJZf4 ( Kulukundis, CppCon 2017 )
+
+*/
+
+namespace ft
+{
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 CONTROL BYTES / GROUP										  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	typedef signed char	ctrl_t;
+
+	static const ctrl_t	ctrl_empty = -128;
+	static const ctrl_t	ctrl_deleted = -2;
+	static const ctrl_t	ctrl_sentinel = -1;
+
+	//  swiss_group : bit masks over 16 control bytes, bit i for byte i  //
+	struct swiss_group
+	{
+		static const std::size_t	width = 16;
+
+# if defined( __SSE2__ )
+
+		__m128i	ctrl;
+
+		explicit swiss_group( const ctrl_t* pos ) : ctrl( _mm_loadu_si128( reinterpret_cast< const __m128i* >( pos ) ) ) {}
+
+		//  match() : bytes equal to h2  //
+		unsigned int	match( ctrl_t h2 ) const
+		{
+			return ( _mm_movemask_epi8( _mm_cmpeq_epi8( _mm_set1_epi8( h2 ) , this->ctrl ) ) );
+		}
+
+		//  match_empty() : empty bytes  //
+		unsigned int	match_empty( void ) const
+		{
+			return ( this->match( ctrl_empty ) );
+		}
+
+		//  match_empty_or_deleted() : bytes under the sentinel, signed  //
+		unsigned int	match_empty_or_deleted( void ) const
+		{
+			return ( _mm_movemask_epi8( _mm_cmpgt_epi8( _mm_set1_epi8( ctrl_sentinel ) , this->ctrl ) ) );
+		}
+
+# else
+
+		const ctrl_t*	ctrl;
+
+		explicit swiss_group( const ctrl_t* pos ) : ctrl( pos ) {}
+
+		//  match() : bytes equal to h2  //
+		unsigned int	match( ctrl_t h2 ) const
+		{
+			unsigned int	ret = 0;
+
+			for ( std::size_t i = 0 ; i < width ; ++i )
+				ret |= static_cast< unsigned int >( this->ctrl[ i ] == h2 ) << i;
+			return ( ret );
+		}
+
+		//  match_empty() : empty bytes  //
+		unsigned int	match_empty( void ) const
+		{
+			return ( this->match( ctrl_empty ) );
+		}
+
+		//  match_empty_or_deleted() : bytes under the sentinel, signed  //
+		unsigned int	match_empty_or_deleted( void ) const
+		{
+			unsigned int	ret = 0;
+
+			for ( std::size_t i = 0 ; i < width ; ++i )
+				ret |= static_cast< unsigned int >( this->ctrl[ i ] < ctrl_sentinel ) << i;
+			return ( ret );
+		}
+
+# endif
+
+		//  lowest() : index of the lowest bit set in a non empty mask  //
+		static std::size_t	lowest( unsigned int mask )
+		{
+			return ( __builtin_ctz( mask ) );
+		}
+
+		//  leading() : zero bits above the highest one in a 16 bits mask  //
+		static std::size_t	leading( unsigned int mask )
+		{
+			return ( ( mask ) ? __builtin_clz( mask ) - ( sizeof( unsigned int ) * 8 - width ) : width );
+		}
+
+		//  trailing() : zero bits under the lowest one in a 16 bits mask  //
+		static std::size_t	trailing( unsigned int mask )
+		{
+			return ( ( mask ) ? __builtin_ctz( mask ) : width );
+		}
+	};
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 SWISS ITERATOR												  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	//  Slot and control byte walked together, the sentinel stops the walk  //
+	template< class T >
+	class swiss_iterator
+	{
+		public :
+
+			//  Members type  //
+			typedef ft::forward_iterator_tag	iterator_category;
+			typedef T							value_type;
+			typedef std::ptrdiff_t				difference_type;
+			typedef T*							pointer;
+			typedef T&							reference;
+
+			//  Attributes  //
+			T*				_slot;		// current slot
+			const ctrl_t*	_ctrl;		// current control byte
+
+		/* -------------------------------------------------------------------*/
+		/* 			 MEMBER FUNCTIONS 										  */
+		/* -------------------------------------------------------------------*/
+
+			//  (1) Default constructor  //
+			swiss_iterator( void ) : _slot( NULL ) , _ctrl( NULL )
+			{
+				return ;
+			}
+
+			//  (2) Position constructor : slot must be full or the sentinel  //
+			swiss_iterator( T* slot , const ctrl_t* ctrl ) : _slot( slot ) , _ctrl( ctrl )
+			{
+				return ;
+			}
+
+			//  (3) Copy constructor  //
+			swiss_iterator( const swiss_iterator< typename remove_const< T >::type >& x ) : _slot( x._slot ) , _ctrl( x._ctrl )
+			{
+				return ;
+			}
+
+			//  Destructor  //
+			~swiss_iterator( void )
+			{
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			swiss_iterator&	operator=( const swiss_iterator& rhs )
+			{
+				this->_slot = rhs._slot;
+				this->_ctrl = rhs._ctrl;
+				return ( *this );
+			}
+
+			//  skip() : moves to the first full slot ( or the sentinel ) from the current one on  //
+			swiss_iterator&	skip( void )
+			{
+				while ( *this->_ctrl < ctrl_sentinel )
+				{
+					++this->_slot;
+					++this->_ctrl;
+				}
+				return ( *this );
+			}
+
+			//  (1) Operator++ : pre-increment version  //
+			swiss_iterator&	operator++( void )
+			{
+				++this->_slot;
+				++this->_ctrl;
+				return ( this->skip() );
+			}
+
+			//  (2) Operator++ : post-increment version  //
+			swiss_iterator	operator++( int )
+			{
+				swiss_iterator	tmp = *this;
+
+				this->operator++();
+				return ( tmp );
+			}
+
+			//  Operator* : dereference iterator : returns a reference to element pointed to by iterator  //
+			T&	operator*( void ) const
+			{
+				return ( *this->_slot );
+			}
+
+			//  Operator-> : dereference iterator, returns pointer to element pointed by iterator  //
+			T*	operator->( void ) const
+			{
+				return ( this->_slot );
+			}
+
+	}; /* class swiss_iterator */
+
+	//  (1) Operator == : mixed const / non const  //
+	template< class T , class U >
+	bool	operator==( const swiss_iterator< T >& lhs , const swiss_iterator< U >& rhs )
+	{
+		return ( lhs._ctrl == rhs._ctrl );
+	}
+
+	//  (2) Operator !=  //
+	template< class T , class U >
+	bool	operator!=( const swiss_iterator< T >& lhs , const swiss_iterator< U >& rhs )
+	{
+		return ( lhs._ctrl != rhs._ctrl );
+	}
+
+	/* -----------------------------------------------------------------------*/
+	/*																		  */
+	/* 			 CLASS SWISS_TABLE											  */
+	/*																		  */
+	/* -----------------------------------------------------------------------*/
+
+	template< class Key , class T , class Hash = ft::hash< Key > , class KeyEqual = std::equal_to< Key > , \
+			class Alloc = std::allocator< ft::pair< const Key , T > > >
+	class swiss_table
+	{
+		public :
+
+		/* ------------------------------------------------------------------ */
+		/* 	Members types											   		  */
+		/* ------------------------------------------------------------------ */
+
+			typedef	Key											key_type;
+			typedef	T											mapped_type;
+			typedef	ft::pair< const key_type , mapped_type >	value_type;
+			typedef	Hash										hasher;
+			typedef	KeyEqual									key_equal;
+			typedef	Alloc										allocator_type;
+			typedef typename allocator_type::size_type			size_type;
+			typedef swiss_iterator< value_type >				iterator;
+			typedef swiss_iterator< const value_type >			const_iterator;
+			typedef typename Alloc::template rebind< ctrl_t >::other	ctrlAlloc;
+
+			static const size_type	width = swiss_group::width;
+			static const size_type	min_capacity = width - 1;
+
+		/* ------------------------------------------------------------------ */
+		/* 	Attributes												  	 	  */
+		/* ------------------------------------------------------------------ */
+
+			value_type*		_slots;			// capacity slots, NULL before the first insert
+			ctrl_t*			_ctrl;			// capacity control bytes, the sentinel, then width - 1 clones
+			size_type		_capacity;		// 2^k - 1, 0 before the first insert
+			size_type		_size;			// values stored
+			size_type		_growth_left;	// empty bytes that may still be filled before a rebuild
+			Hash			_hash;			// hasher
+			KeyEqual		_eq;			// key_equal
+			Alloc			_alloc;			// slot allocator
+			ctrlAlloc		_bytes;			// control bytes allocator
+
+		/* -------------------------------------------------------------------*/
+		/* 	Members functions												  */
+		/* -------------------------------------------------------------------*/
+
+			//  Constructor : room for n values without a rebuild  //
+			swiss_table( size_type n = 0 , const hasher& hf = hasher() , const key_equal& eq = key_equal() , const allocator_type& alloc = allocator_type() )
+				: _slots( NULL ) , _ctrl( NULL ) , _capacity( 0 ) , _size( 0 ) , _growth_left( 0 ) , _hash( hf ) , _eq( eq ) , \
+				_alloc( alloc ) , _bytes( alloc )
+			{
+				if ( n )
+					this->resize( capacity_for( n ) );
+				return ;
+			}
+
+			//  Copy constructor : slot for slot, no hashing  //
+			swiss_table( const swiss_table& x ) : _slots( NULL ) , _ctrl( NULL ) , _capacity( 0 ) , _size( 0 ) , _growth_left( 0 ) , \
+				_hash( x._hash ) , _eq( x._eq ) , _alloc( x._alloc ) , _bytes( x._bytes )
+			{
+				this->assign( x );
+				return ;
+			}
+
+			//  Destructor  //
+			~swiss_table( void )
+			{
+				this->clear();
+				this->deallocate();
+				return ;
+			}
+
+			//  Operator '=' overload  //
+			swiss_table&	operator=( const swiss_table& x )
+			{
+				if ( this != &x )
+				{
+					this->_hash = x._hash;
+					this->_eq = x._eq;
+					this->assign( x );
+				}
+				return ( *this );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      ITERATORS                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  begin() : first full slot  //
+			iterator	begin( void )
+			{
+				if ( !this->_capacity )
+					return ( iterator() );
+				return ( iterator( this->_slots , this->_ctrl ).skip() );
+			}
+
+			//  const begin()  //
+			const_iterator	begin( void ) const
+			{
+				if ( !this->_capacity )
+					return ( const_iterator() );
+				return ( const_iterator( this->_slots , this->_ctrl ).skip() );
+			}
+
+			//  end() : the sentinel  //
+			iterator	end( void )
+			{
+				return ( iterator( this->_slots + this->_capacity , this->_ctrl + this->_capacity ) );
+			}
+
+			//  const end()  //
+			const_iterator	end( void ) const
+			{
+				return ( const_iterator( this->_slots + this->_capacity , this->_ctrl + this->_capacity ) );
+			}
+
+			//  at() : iterator on slot i  //
+			iterator	at( size_type i )
+			{
+				return ( iterator( this->_slots + i , this->_ctrl + i ) );
+			}
+
+			//  end_slot() : index past the last slot, what find_slot() returns for a missing key  //
+			size_type	end_slot( void ) const
+			{
+				return ( this->_capacity );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      HASHING                        			  */
+			/* -------------------------------------------------------------- */
+
+			//  hash_of() : mixed hash of key k, H1 is hash >> 7 and H2 hash & 0x7F  //
+			std::size_t	hash_of( const key_type& k ) const
+			{
+				return ( ft::hash_mix( this->_hash( k ) ) );
+			}
+
+			//  h2() : control byte of a full slot  //
+			static ctrl_t	h2( std::size_t hash )
+			{
+				return ( static_cast< ctrl_t >( hash & 0x7F ) );
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      LOOKUP                         			  */
+			/* -------------------------------------------------------------- */
+
+			//  find_slot() : slot holding key k, capacity if none ; only the keys of H2 matches are compared  //
+			size_type	find_slot( const key_type& k ) const
+			{
+				std::size_t		hash;
+				size_type		offset;
+				size_type		step = 0;
+				unsigned int	mask;
+
+				if ( !this->_size )
+					return ( this->_capacity );
+				hash = this->hash_of( k );
+				offset = ( hash >> 7 ) & this->_capacity;
+				while ( true )
+				{
+					swiss_group	group( this->_ctrl + offset );
+
+					for ( mask = group.match( h2( hash ) ) ; mask ; mask &= mask - 1 )
+					{
+						size_type	i = ( offset + swiss_group::lowest( mask ) ) & this->_capacity;
+
+						if ( this->_eq( this->_slots[ i ].first , k ) )
+							return ( i );
+					}
+					if ( group.match_empty() )
+						return ( this->_capacity );
+					step += width;
+					offset = ( offset + step ) & this->_capacity;
+				}
+			}
+
+			//  first_free() : first empty or deleted slot of hash probe sequence  //
+			size_type	first_free( std::size_t hash ) const
+			{
+				size_type		offset = ( hash >> 7 ) & this->_capacity;
+				size_type		step = 0;
+				unsigned int	mask;
+
+				while ( true )
+				{
+					mask = swiss_group( this->_ctrl + offset ).match_empty_or_deleted();
+					if ( mask )
+						return ( ( offset + swiss_group::lowest( mask ) ) & this->_capacity );
+					step += width;
+					offset = ( offset + step ) & this->_capacity;
+				}
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      MODIFIERS                      			  */
+			/* -------------------------------------------------------------- */
+
+			//  insert() : slot of val key, val is copied in first if the key is not there yet  //
+			//  A deleted slot is reused for free ; an empty one needs growth left, else the table is rebuilt first  //
+			ft::pair< size_type , bool >	insert( const value_type& val )
+			{
+				size_type	i = this->find_slot( val.first );
+				std::size_t	hash;
+
+				if ( i != this->_capacity )
+					return ( ft::pair< size_type , bool >( i , false ) );
+				hash = this->hash_of( val.first );
+				if ( !this->_capacity )
+					this->resize( min_capacity );
+				i = this->first_free( hash );
+				if ( !this->_growth_left && this->_ctrl[ i ] != ctrl_deleted )
+				{
+					this->rebuild();
+					i = this->first_free( hash );
+				}
+				this->_alloc.construct( this->_slots + i , val );
+				this->_growth_left -= ( this->_ctrl[ i ] == ctrl_empty );
+				this->set_ctrl( i , h2( hash ) );
+				++this->_size;
+				return ( ft::pair< size_type , bool >( i , true ) );
+			}
+
+			//  erase_slot() : destroys the value of slot i ; empty byte if the groups around i always had an empty byte  //
+			//  within one group width of it, no probe went past it then ; deleted byte otherwise  //
+			void	erase_slot( size_type i )
+			{
+				unsigned int	after = swiss_group( this->_ctrl + i ).match_empty();
+				unsigned int	before = swiss_group( this->_ctrl + ( ( i - width ) & this->_capacity ) ).match_empty();
+
+				this->_alloc.destroy( this->_slots + i );
+				--this->_size;
+				if ( before && after && swiss_group::trailing( after ) + swiss_group::leading( before ) < width )
+				{
+					this->set_ctrl( i , ctrl_empty );
+					++this->_growth_left;
+				}
+				else
+					this->set_ctrl( i , ctrl_deleted );
+				return ;
+			}
+
+			//  clear() : destroys every value, slots are kept  //
+			void	clear( void )
+			{
+				if ( !this->_capacity )
+					return ;
+				for ( size_type i = 0 ; i < this->_capacity ; ++i )
+				{
+					if ( this->_ctrl[ i ] >= 0 )
+						this->_alloc.destroy( this->_slots + i );
+				}
+				this->reset_ctrl();
+				this->_size = 0;
+				return ;
+			}
+
+			//  swap() : exchanges tables with x, O(1)  //
+			void	swap( swiss_table& x )
+			{
+				swiss_table	tmp( 0 , x._hash , x._eq , x._alloc );
+
+				tmp.steal( x );
+				x.steal( *this );
+				this->steal( tmp );
+				return ;
+			}
+
+			/* -------------------------------------------------------------- */
+			/*                      CAPACITY                       			  */
+			/* -------------------------------------------------------------- */
+
+			//  growth() : values a capacity holds before a rebuild, 7/8 of it  //
+			static size_type	growth( size_type capacity )
+			{
+				return ( capacity - capacity / 8 );
+			}
+
+			//  capacity_for() : smallest 2^k - 1 capacity holding n values  //
+			static size_type	capacity_for( size_type n )
+			{
+				size_type	ret = min_capacity;
+
+				while ( growth( ret ) < n )
+					ret = ret * 2 + 1;
+				return ( ret );
+			}
+
+			//  rebuild() : out of growth : same capacity if deleted slots took it (size up to 25/32), twice as much otherwise  //
+			void	rebuild( void )
+			{
+				if ( this->_capacity > width && this->_size * 32 <= this->_capacity * 25 )
+					this->resize( this->_capacity );
+				else
+					this->resize( this->_capacity * 2 + 1 );
+				return ;
+			}
+
+			//  resize() : moves every value to a new table of the given capacity, deleted bytes are dropped  //
+			void	resize( size_type capacity )
+			{
+				swiss_table	tmp( 0 , this->_hash , this->_eq , this->_alloc );
+				std::size_t	hash;
+				size_type	i;
+
+				tmp.allocate( capacity );
+				for ( size_type j = 0 ; j < this->_capacity ; ++j )
+				{
+					if ( this->_ctrl[ j ] < 0 )
+						continue ;
+					hash = tmp.hash_of( this->_slots[ j ].first );
+					i = tmp.first_free( hash );
+					tmp._alloc.construct( tmp._slots + i , this->_slots[ j ] );
+					tmp.set_ctrl( i , h2( hash ) );
+					++tmp._size;
+					--tmp._growth_left;
+				}
+				this->swap( tmp );
+				return ;
+			}
+
+		private :
+
+			//  set_ctrl() : control byte of slot i, and its clone after the sentinel for the first width - 1 slots  //
+			void	set_ctrl( size_type i , ctrl_t h )
+			{
+				this->_ctrl[ i ] = h;
+				this->_ctrl[ ( ( i - ( width - 1 ) ) & this->_capacity ) + ( width - 1 ) ] = h;
+				return ;
+			}
+
+			//  reset_ctrl() : every byte empty but the sentinel, full growth  //
+			void	reset_ctrl( void )
+			{
+				for ( size_type i = 0 ; i < this->_capacity + width ; ++i )
+					this->_ctrl[ i ] = ctrl_empty;
+				if ( this->_capacity )
+					this->_ctrl[ this->_capacity ] = ctrl_sentinel;
+				this->_growth_left = growth( this->_capacity );
+				return ;
+			}
+
+			//  allocate() : empty table of the given capacity, 2^k - 1 and at least width - 1  //
+			void	allocate( size_type capacity )
+			{
+				this->_slots = this->_alloc.allocate( capacity );
+				try
+				{
+					this->_ctrl = this->_bytes.allocate( capacity + width );
+				}
+				catch ( ... )
+				{
+					this->_alloc.deallocate( this->_slots , capacity );
+					this->_slots = NULL;
+					throw ;
+				}
+				this->_capacity = capacity;
+				this->reset_ctrl();
+				return ;
+			}
+
+			//  deallocate() : frees the slots of an empty table  //
+			void	deallocate( void )
+			{
+				if ( !this->_capacity )
+					return ;
+				this->_alloc.deallocate( this->_slots , this->_capacity );
+				this->_bytes.deallocate( this->_ctrl , this->_capacity + width );
+				this->_slots = NULL;
+				this->_ctrl = NULL;
+				this->_capacity = 0;
+				this->_growth_left = 0;
+				return ;
+			}
+
+			//  steal() : takes x table, leaving x without one  //
+			void	steal( swiss_table& x )
+			{
+				this->_slots = x._slots;
+				this->_ctrl = x._ctrl;
+				this->_capacity = x._capacity;
+				this->_size = x._size;
+				this->_growth_left = x._growth_left;
+				this->_hash = x._hash;
+				this->_eq = x._eq;
+				this->_alloc = x._alloc;
+				this->_bytes = x._bytes;
+				x._slots = NULL;
+				x._ctrl = NULL;
+				x._capacity = 0;
+				x._size = 0;
+				x._growth_left = 0;
+				return ;
+			}
+
+			//  assign() : copy of x slot for slot, control bytes included  //
+			void	assign( const swiss_table& x )
+			{
+				this->clear();
+				if ( this->_capacity != x._capacity )
+				{
+					this->deallocate();
+					if ( x._capacity )
+						this->allocate( x._capacity );
+				}
+				for ( size_type i = 0 ; i < x._capacity ; ++i )
+				{
+					if ( x._ctrl[ i ] >= 0 )
+					{
+						this->_alloc.construct( this->_slots + i , x._slots[ i ] );
+						this->set_ctrl( i , x._ctrl[ i ] );
+						++this->_size;
+					}
+				}
+				for ( size_type i = 0 ; i < x._capacity ; ++i )
+				{
+					if ( x._ctrl[ i ] == ctrl_deleted )
+						this->set_ctrl( i , ctrl_deleted );
+				}
+				this->_growth_left = x._growth_left;
+				return ;
+			}
+
+	}; /* class swiss_table */
+
+} /* namespace ft */
+
+#endif /* SWISS_TABLE_HPP */
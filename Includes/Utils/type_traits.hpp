@@ -13,7 +13,7 @@
 #ifndef TYPE_TRAITS_HPP
 # define TYPE_TRAITS_HPP
 
-# include <atomic>
+# include <cstddef>
 
 /*
 
@@ -28,9 +28,16 @@ Enable_if	--> type T is enabled as member type enable_if::type if Cond is
 
 Is_integral	--> trait class that identifies whether T is an integral type.
 
+Has_is_transparent
+			--> true if Compare declares a member type is_transparent, i.e. 
+				it can compare keys with other types than key_type. Probe is 
+				only there to make the trait depend on a member template 
+				parameter, so that enable_if on it is SFINAE.
+
 Unless otherwise indicated all refs come from :
 	https://cplusplus.com/reference/type_traits/enable_if/
 	https://cplusplus.com/reference/type_traits/is_integral/
+	https://en.cppreference.com/w/cpp/utility/functional/less_void
 
 */
 
@@ -155,6 +162,31 @@ namespace ft
 		static const bool	value = true;
 	};
 
+	/* ---------------------------------------------------------------------- */
+	/*																		  */
+	/* 		HAS_IS_TRANSPARENT									   	  		  */
+	/*																		  */
+	/* ---------------------------------------------------------------------- */
+
+	template< class Compare , class Probe = void >
+	struct has_is_transparent
+	{
+		private :
+
+			typedef char				yes;
+			typedef struct { char c[ 2 ]; }	no;
+
+			template< class U >
+			static yes	test( typename U::is_transparent* );
+
+			template< class U >
+			static no	test( ... );
+
+		public :
+
+			static const bool	value = ( sizeof( test< Compare >( 0 ) ) == sizeof( yes ) );
+	};
+
 } /* namespace ft */
 
 #endif /* TYPE_TRAITS_HPP */
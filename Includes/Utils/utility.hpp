@@ -22,6 +22,15 @@ Utility components 	--> header contains utilities in unrelated domains :
 								may be of different types (T1 and T2)
 					--> make_pair : function constructs a pair object
 
+	- Sorted unique tag : empty type telling a range constructor its input is 
+					already sorted by key without duplicates, so checks can be 
+					skipped
+
+	- Transparent less : comparison object declaring is_transparent, 
+					it compares two values of any types with '<', so 
+					a map< std::string , T > using it is searched with a 
+					const char* without building a std::string
+
 Unless otherwise indicated all refs come from :
 	https://cplusplus.com/reference/utility/pair/?kw=pair
 
@@ -142,6 +151,33 @@ namespace ft
 		return ( !( lhs < rhs ) ); 
 	}
 
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 SORTED UNIQUE TAG										  	  */
+	/*																	 	  */
+	/* -----------------------------------------------------------------------*/
+
+	struct	sorted_unique_t {};
+
+	const sorted_unique_t	sorted_unique = sorted_unique_t();
+
+	/* -----------------------------------------------------------------------*/
+	/*																	  	  */
+	/* 			 TRANSPARENT LESS										  	  */
+	/*																	 	  */
+	/* -----------------------------------------------------------------------*/
+
+	struct	transparent_less
+	{
+		typedef void	is_transparent;
+
+		template< class T1 , class T2 >
+		bool	operator()( const T1& a , const T2& b ) const
+		{
+			return ( a < b );
+		}
+	};
+
 } /* namespace ft */
 
 #endif /* UTILITY_HPP */
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_aggregate_map.cpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:14:20 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <map>
+
+#include "../Includes/Containers/aggregate_map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  Not commutative : any element combined out of key order shows  //
+struct concat_monoid
+{
+	typedef std::string	value_type;
+
+	value_type	identity( void ) const
+	{
+		return ( value_type() );
+	}
+
+	value_type	operator()( const value_type& a , const value_type& b ) const
+	{
+		return ( a + b );
+	}
+};
+
+//  brute_aggregate() : monoid of the std::map values with a key in [lo, hi[, one by one  //
+template< class Monoid >
+static typename Monoid::value_type	brute_aggregate( const std::map< int , typename Monoid::value_type >& ref , int lo , int hi )
+{
+	Monoid										op;
+	typename Monoid::value_type					ret = op.identity();
+	typename std::map< int , typename Monoid::value_type >::const_iterator	it = ref.lower_bound( lo );
+
+	for ( ; it != ref.end() && it->first < hi ; ++it )
+		ret = op( ret , it->second );
+	return ( ret );
+}
+
+static std::string	value_of( int i )
+{
+	return ( std::string( 1 , static_cast< char >( 'a' + i % 26 ) ) );
+}
+
+static int	value_of_int( int i )
+{
+	return ( i % 1000 - 500 );
+}
+
+//  Random updates, every window checked against std::map  //
+template< class Monoid , class V >
+static void	window_tests( const char* name , V ( *value )( int ) )
+{
+	typedef ft::aggregate_map< int , V , Monoid >	map_type;
+
+	cout << "--- aggregate_map " << name << " ---\n";
+	map_type				m;
+	std::map< int , V >		ref;
+
+	std::srand( 17 );
+	for ( int round = 0 ; round < 30000 ; ++round )
+	{
+		int	k = std::rand() % 2000;
+		int	op = std::rand() % 6;
+
+		if ( op < 2 )
+		{
+			m.insert( ft::make_pair( k , value( round ) ) );
+			ref.insert( std::make_pair( k , value( round ) ) );
+		}
+		else if ( op == 2 )
+		{
+			m.insert_or_assign( k , value( round ) );
+			ref[ k ] = value( round );
+		}
+		else if ( op == 3 )
+		{
+			m.erase( k );
+			ref.erase( k );
+		}
+		else if ( op == 4 )
+		{
+			int	hi = k + std::rand() % 20;
+
+			m.erase( m.lower_bound( k ) , m.lower_bound( hi ) );
+			ref.erase( ref.lower_bound( k ) , ref.lower_bound( hi ) );
+		}
+		else
+		{
+			int	lo = std::rand() % 2100 - 50;
+			int	hi = lo + std::rand() % 300;
+
+			check( m.aggregate( lo , hi ) == brute_aggregate< Monoid >( ref , lo , hi ) , "aggregate( lo , hi )" );
+		}
+		if ( round % 5000 == 0 )
+		{
+			map_type	copy( m );
+
+			check( m.aggregate() == brute_aggregate< Monoid >( ref , -1 , 1 << 30 ) , "aggregate() of the whole map" );
+			check( copy.aggregate( 100 , 1500 ) == m.aggregate( 100 , 1500 ) && copy == m , "copies keep the caches" );
+		}
+	}
+	cout << "aggregate_map " << name << ": done\n";
+}
+
+//  Caches of both sides must be right after split() and join()  //
+static void	split_join_tests()
+{
+	cout << "--- aggregate_map split and join ---\n";
+	typedef ft::aggregate_map< int , std::string , concat_monoid >	map_type;
+	map_type						m;
+	std::map< int , std::string >	ref;
+
+	for ( int i = 0 ; i < 3000 ; ++i )
+	{
+		m.insert( ft::make_pair( i , value_of( i ) ) );
+		ref.insert( std::make_pair( i , value_of( i ) ) );
+	}
+	for ( int at = 0 ; at <= 3000 ; at += 250 )
+	{
+		map_type	upper;
+
+		m.split( at , upper );
+
+		check( m.aggregate() == brute_aggregate< concat_monoid >( ref , 0 , at ) , "lower half after split()" );
+		check( upper.aggregate() == brute_aggregate< concat_monoid >( ref , at , 3000 ) , "upper half after split()" );
+		check( upper.aggregate( at + 10 , at + 90 ) == brute_aggregate< concat_monoid >( ref , at + 10 , at + 90 ) , "window in the upper half" );
+		if ( at % 500 )
+		{
+			check( upper.join( m ) && m.empty() , "join() of the lower half" );
+			m.swap( upper );
+		}
+		else
+			check( m.join( upper ) && upper.empty() , "join() of the upper half" );
+		check( m.aggregate() == brute_aggregate< concat_monoid >( ref , 0 , 3000 ) , "whole map after join()" );
+	}
+	cout << "aggregate_map split and join: done\n";
+}
+
+int main( void )
+{
+	window_tests< ft::sum_monoid< int > , int >( "sum" , value_of_int );
+	window_tests< ft::min_monoid< int > , int >( "min" , value_of_int );
+	window_tests< ft::max_monoid< int > , int >( "max" , value_of_int );
+	window_tests< concat_monoid , std::string >( "concatenation" , value_of );
+	split_join_tests();
+	return ( checks_result() );
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_bench_hash.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:02:37 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 11:02:37 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include <map>
+
+#include "../Includes/Containers/map.hpp"
+#include "../Includes/Containers/unordered_map.hpp"
+#include "../Includes/Containers/flat_hash_map.hpp"
+
+using std::cout;
+
+//  Keys are i * 2654435761 mod 2^32 : distinct for every i, spread over the  //
+//  whole range. Indexes [0, n[ are inserted, [n, 2n[ are only looked up.  //
+static unsigned int	key_of( size_t i )
+{
+	return ( static_cast< unsigned int >( i ) * 2654435761u );
+}
+
+static double operator-(const timespec& a, const timespec& b)
+{
+	return (a.tv_sec + a.tv_nsec / 1000000000.) - (b.tv_sec + b.tv_nsec / 1000000000.);
+}
+
+template < class Map >
+static void	hash_benchmark( const char* name , size_t n )
+{
+	typedef typename Map::value_type	value_type;
+	timespec	tp1, tp2;
+	size_t		found = 0;
+	Map			m;
+
+	cout << "--- " << name << " ---\n";
+	clock_gettime(CLOCK_MONOTONIC, &tp1);
+	for (size_t i = 0; i < n; i++)
+		m.insert(value_type(key_of(i), static_cast< int >(i)));
+	clock_gettime(CLOCK_MONOTONIC, &tp2);
+	cout << n << " inserts: " << tp2 - tp1 << "s\n";
+	clock_gettime(CLOCK_MONOTONIC, &tp1);
+	for (size_t i = 0; i < n; i++)
+		found += (m.find(key_of((i * 7) % n)) != m.end());
+	clock_gettime(CLOCK_MONOTONIC, &tp2);
+	cout << n << " hit finds: " << tp2 - tp1 << "s\n";
+	clock_gettime(CLOCK_MONOTONIC, &tp1);
+	for (size_t i = 0; i < n; i++)
+		found += (m.find(key_of(n + i)) != m.end());
+	clock_gettime(CLOCK_MONOTONIC, &tp2);
+	cout << n << " miss finds: " << tp2 - tp1 << "s\n";
+	clock_gettime(CLOCK_MONOTONIC, &tp1);
+	for (size_t i = 0; i < n; i++)
+		found += (m.find(key_of(i % 16 ? n + i : i)) != m.end());
+	clock_gettime(CLOCK_MONOTONIC, &tp2);
+	cout << n << " mixed finds (1/16 hits): " << tp2 - tp1 << "s\n";
+	if (found != n + (n + 15) / 16)
+		cout << "unexpected hit count: " << found << '\n';
+}
+
+//  Usage : ./bench_hash [n] , n defaults to 1000000 and may go up to  //
+//  100000000 given enough memory (the tree maps need ~50 bytes per entry).  //
+int main( int argc , char** argv )
+{
+	size_t	n = 1000000;
+
+	if (argc > 1)
+		n = std::strtoul(argv[1], NULL, 10);
+	if (n == 0 || n > 100000000)
+	{
+		cout << "n must be in [1, 100000000]\n";
+		return (1);
+	}
+	hash_benchmark< ft::flat_hash_map< unsigned int , int > >("ft::flat_hash_map", n);
+	hash_benchmark< ft::unordered_map< unsigned int , int > >("ft::unordered_map", n);
+	hash_benchmark< ft::map< unsigned int , int > >("ft::map", n);
+	hash_benchmark< std::map< unsigned int , int > >("std::map", n);
+
+	return (0);
+}
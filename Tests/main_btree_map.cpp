@@ -0,0 +1,223 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_btree_map.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:24:37 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <map>
+
+#include "../Includes/Containers/btree_map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  Allocator counting the bytes it has handed out and not yet taken back  //
+static std::size_t	g_live = 0;
+
+template< class T >
+class counting_allocator : public std::allocator< T >
+{
+	public :
+
+		template< class U >
+		struct rebind
+		{
+			typedef counting_allocator< U >	other;
+		};
+
+		counting_allocator( void ) {}
+		counting_allocator( const counting_allocator& x ) : std::allocator< T >( x ) {}
+		template< class U >
+		counting_allocator( const counting_allocator< U >& x ) : std::allocator< T >( x ) {}
+
+		T*	allocate( std::size_t n , const void* = 0 )
+		{
+			g_live += n * sizeof( T );
+			return ( std::allocator< T >::allocate( n ) );
+		}
+
+		void	deallocate( T* p , std::size_t n )
+		{
+			g_live -= n * sizeof( T );
+			std::allocator< T >::deallocate( p , n );
+		}
+};
+
+//  Key whose copy throws once g_copies_left copies were made, g_objects counts the live ones  //
+static long	g_copies_left = -1;
+static long	g_objects = 0;
+
+struct throwing_key
+{
+	int	v;
+
+	throwing_key( int x = 0 ) : v( x )
+	{
+		++g_objects;
+	}
+
+	throwing_key( const throwing_key& x ) : v( x.v )
+	{
+		if ( g_copies_left == 0 )
+			throw ( std::runtime_error( "throwing_key" ) );
+		if ( g_copies_left > 0 )
+			--g_copies_left;
+		++g_objects;
+	}
+
+	~throwing_key( void )
+	{
+		--g_objects;
+	}
+
+	bool	operator<( const throwing_key& x ) const
+	{
+		return ( this->v < x.v );
+	}
+};
+
+typedef ft::btree_map< throwing_key , int , std::less< throwing_key > , \
+		counting_allocator< ft::pair< const throwing_key , int > > >	throwing_map;
+
+//  A copy interrupted at any value or separator key must give every node and object back  //
+static void	copy_exception_tests()
+{
+	cout << "--- btree_map copy exception safety ---\n";
+	const int	sizes[] = { 1 , 5 , 300 , 3000 };
+
+	for ( int s = 0 ; s < 4 ; ++s )
+	{
+		throwing_map	src;
+
+		for ( int i = 0 ; i < sizes[s] ; ++i )
+			src.insert( ft::make_pair( throwing_key( i ) , i ) );
+
+		const std::size_t	bytes = g_live;
+		const long			objects = g_objects;
+		bool				completed = false;
+
+		for ( long n = 0 ; !completed ; ++n )
+		{
+			g_copies_left = n;
+			try
+			{
+				throwing_map	dst( src );
+
+				completed = true;
+				g_copies_left = -1;
+				check( dst.size() == src.size() , "copy completes once no copy throws" );
+			}
+			catch ( std::runtime_error& )
+			{
+			}
+			g_copies_left = -1;
+			check( g_live == bytes && g_objects == objects , "copy constructor leaves nothing behind" );
+		}
+
+		throwing_map	dst;
+
+		for ( int i = 0 ; i < 50 ; ++i )
+			dst.insert( ft::make_pair( throwing_key( -1 - i ) , i ) );
+		g_copies_left = sizes[s] / 2;
+		try
+		{
+			dst = src;
+		}
+		catch ( std::runtime_error& )
+		{
+		}
+		g_copies_left = -1;
+		check( dst.empty() || dst.size() == src.size() , "operator= leaves an empty or full map" );
+		dst.clear();
+		check( g_live == bytes && g_objects == objects , "operator= leaves nothing behind" );
+		dst = src;
+		check( dst.size() == src.size() && dst.begin()->first.v == 0 , "operator= after a failed one" );
+	}
+	cout << "btree_map copy exception safety: done\n";
+}
+
+static std::string	key_name( int i )
+{
+	std::string	ret( "key" );
+
+	for ( int n = 0 ; n < 6 ; ++n , i /= 10 )
+		ret.insert( ret.begin() + 3 , static_cast< char >( '0' + i % 10 ) );
+	return ( ret );
+}
+
+//  Random inserts, erases and lookups, replayed on std::map  //
+static void	std_map_tests()
+{
+	cout << "--- btree_map against std::map ---\n";
+	ft::btree_map< std::string , int >	m;
+	std::map< std::string , int >		ref;
+
+	std::srand( 42 );
+	for ( int round = 0 ; round < 60000 ; ++round )
+	{
+		std::string	k = key_name( std::rand() % 5000 );
+		int			op = std::rand() % 8;
+
+		if ( op < 3 )
+		{
+			bool	added = m.insert( ft::make_pair( k , round ) ).second;
+
+			check( added == ref.insert( std::make_pair( k , round ) ).second , "insert() reports the same" );
+		}
+		else if ( op == 3 )
+		{
+			m[ k ] += round;
+			ref[ k ] += round;
+		}
+		else if ( op == 4 )
+			check( m.erase( k ) == ref.erase( k ) , "erase( key ) count" );
+		else if ( op == 5 )
+		{
+			std::string	hi = key_name( std::rand() % 5000 );
+
+			if ( hi < k )
+				hi.swap( k );
+			m.erase( m.lower_bound( k ) , m.lower_bound( hi ) );
+			ref.erase( ref.lower_bound( k ) , ref.lower_bound( hi ) );
+		}
+		else
+		{
+			ft::btree_map< std::string , int >::iterator	it = m.lower_bound( k );
+			std::map< std::string , int >::iterator			sit = ref.lower_bound( k );
+
+			check( ( it == m.end() ) == ( sit == ref.end() ) && ( sit == ref.end() || it->first == sit->first ) , "lower_bound()" );
+			check( ( m.find( k ) == m.end() ) == ( ref.find( k ) == ref.end() ) , "find()" );
+			check( ( m.upper_bound( k ) == m.end() ) == ( ref.upper_bound( k ) == ref.end() ) , "upper_bound()" );
+			check( ft::distance( m.equal_range( k ).first , m.equal_range( k ).second ) == \
+					std::distance( ref.equal_range( k ).first , ref.equal_range( k ).second ) , "equal_range()" );
+		}
+		if ( round % 10000 == 0 )
+		{
+			ft::btree_map< std::string , int >	copy( m );
+
+			check( same_both_ways( m , ref ) && copy == m , "content and copy" );
+		}
+	}
+	check( same_both_ways( m , ref ) , "final content" );
+	m.erase( m.begin() , m.end() );
+	check( m.empty() && m.begin() == m.end() , "erase( begin , end ) empties the map" );
+	cout << "btree_map against std::map: done\n";
+}
+
+int main( void )
+{
+	std_map_tests();
+	copy_exception_tests();
+	return ( checks_result() );
+}
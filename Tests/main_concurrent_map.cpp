@@ -0,0 +1,246 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_concurrent_map.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:48:26 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../Includes/Containers/concurrent_map.hpp"
+#include "test_utils.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <map>
+#include <pthread.h>
+
+using std::cout;
+
+typedef ft::concurrent_map< int , int >	map_type;
+typedef std::map< int , int >			ref_type;
+
+//  collect : for_each() functor copying every element it is given  //
+struct collect
+{
+	std::vector< std::pair< int , int > >*	out;
+
+	void	operator()( const ft::pair< const int , int >& val ) const
+	{
+		this->out->push_back( std::make_pair( val.first , val.second ) );
+		return ;
+	}
+};
+
+//  add : update() functor  //
+struct add
+{
+	int	value;
+
+	void	operator()( int& mapped ) const
+	{
+		mapped += this->value;
+		return ;
+	}
+};
+
+//  Random single thread operations, replayed on std::map  //
+static void	std_map_tests()
+{
+	cout << "--- concurrent_map against std::map ---\n";
+	map_type	m( 5 );
+	ref_type	ref;
+
+	check( m.shard_count() == 8 , "shard count rounded up to a power of two" );
+	std::srand( 20 );
+	for ( int round = 0 ; round < 50000 ; ++round )
+	{
+		int	k = std::rand() % 3000;
+		int	op = std::rand() % 6;
+		int	obj = 0;
+
+		if ( op == 0 )
+			check( m.insert( ft::make_pair( k , round ) ) == ref.insert( std::make_pair( k , round ) ).second , "insert()" );
+		else if ( op == 1 )
+			check( m.erase( k ) == ref.erase( k ) , "erase()" );
+		else if ( op == 2 )
+		{
+			check( m.insert_or_assign( k , round ) == !ref.count( k ) , "insert_or_assign()" );
+			ref[ k ] = round;
+		}
+		else if ( op == 3 )
+		{
+			add	f = { 5 };
+
+			check( m.update( k , f ) == ( ref.count( k ) == 1 ) , "update()" );
+			if ( ref.count( k ) )
+				ref[ k ] += 5;
+		}
+		else if ( op == 4 )
+			check( m.find( k , obj ) == ( ref.count( k ) == 1 ) && ( !ref.count( k ) || obj == ref[ k ] ) , "find()" );
+		else
+			check( m.count( k ) == ref.count( k ) , "count()" );
+	}
+
+	std::vector< std::pair< int , int > >	all;
+	collect									f = { &all };
+
+	m.for_each_ordered( f );
+	check( m.size() == ref.size() && ref_type( all.begin() , all.end() ) == ref && all.size() == ref.size() , "for_each_ordered() gives std::map content" );
+	for ( std::size_t i = 1 ; i < all.size() ; ++i )
+		check( all[ i - 1 ].first < all[ i ].first , "for_each_ordered() in key order" );
+	all.clear();
+	m.for_each( f );
+	check( ref_type( all.begin() , all.end() ) == ref , "for_each() visits every element" );
+	m.clear();
+	check( m.empty() && m.size() == 0 , "clear()" );
+
+	ft::concurrent_map< std::string , int >	names( 1 );
+	int										obj = 0;
+
+	names.insert( ft::make_pair( std::string( "one" ) , 1 ) );
+	check( names.find( "one" , obj ) && obj == 1 && !names.count( "two" ) , "std::string keys" );
+	cout << "concurrent_map against std::map: done\n";
+}
+
+//  Six writers own the keys equal to their id modulo 8, mapped values stay equal to their key modulo 8  //
+static const int	g_writers = 6;
+static const int	g_readers = 2;
+static map_type*	g_map = NULL;
+static int			g_done = 0;
+
+struct writer_job
+{
+	int			id;
+	ref_type	ref;
+};
+
+struct reader_job
+{
+	unsigned int	seed;
+	bool			ok;
+};
+
+static void*	writer( void* arg )
+{
+	writer_job*		job = static_cast< writer_job* >( arg );
+	unsigned int	seed = job->id + 1;
+
+	for ( int i = 0 ; i < 30000 ; ++i )
+	{
+		int	k = ( rand_r( &seed ) % 1000 ) * 8 + job->id;
+		int	op = rand_r( &seed ) % 4;
+
+		if ( op == 0 )
+		{
+			g_map->insert( ft::make_pair( k , k ) );
+			job->ref.insert( std::make_pair( k , k ) );
+		}
+		else if ( op == 1 )
+		{
+			g_map->erase( k );
+			job->ref.erase( k );
+		}
+		else if ( op == 2 )
+		{
+			add	f = { 8 };
+
+			if ( g_map->update( k , f ) )
+				job->ref[ k ] += 8;
+		}
+		else
+		{
+			g_map->insert_or_assign( k , k + 16 );
+			job->ref[ k ] = k + 16;
+		}
+	}
+	return ( NULL );
+}
+
+static void*	reader( void* arg )
+{
+	reader_job*	job = static_cast< reader_job* >( arg );
+
+	job->ok = true;
+	while ( !__sync_fetch_and_add( &g_done , 0 ) )
+	{
+		std::vector< std::pair< int , int > >	all;
+		collect									f = { &all };
+		int										obj = 0;
+
+		for ( int i = 0 ; i < 200 ; ++i )
+		{
+			int	k = rand_r( &job->seed ) % 8000;
+
+			if ( g_map->find( k , obj ) && ( obj - k ) % 8 )
+				job->ok = false;
+		}
+		g_map->for_each_ordered( f );
+		for ( std::size_t i = 0 ; i < all.size() ; ++i )
+		{
+			if ( ( i && all[ i - 1 ].first >= all[ i ].first ) || ( all[ i ].second - all[ i ].first ) % 8 )
+				job->ok = false;
+		}
+	}
+	return ( NULL );
+}
+
+static void	threaded_tests()
+{
+	cout << "--- concurrent_map with " << g_writers << " writers and " << g_readers << " readers ---\n";
+	map_type		m;
+	writer_job		writers[ g_writers ];
+	reader_job		readers[ g_readers ];
+	pthread_t		threads[ g_writers + g_readers ];
+	ref_type		ref;
+
+	g_map = &m;
+	for ( int t = 0 ; t < g_readers + g_writers ; ++t )
+	{
+		int	failed;
+
+		if ( t < g_readers )
+		{
+			readers[ t ].seed = 100 + t;
+			failed = pthread_create( &threads[ t ] , NULL , reader , &readers[ t ] );
+		}
+		else
+		{
+			writers[ t - g_readers ].id = t - g_readers;
+			failed = pthread_create( &threads[ t ] , NULL , writer , &writers[ t - g_readers ] );
+		}
+		if ( failed )
+		{
+			cout << "KO: pthread_create()\n";
+			std::exit( 1 );
+		}
+	}
+	for ( int t = g_readers ; t < g_readers + g_writers ; ++t )
+		pthread_join( threads[ t ] , NULL );
+	__sync_fetch_and_add( &g_done , 1 );
+	for ( int t = 0 ; t < g_readers ; ++t )
+		pthread_join( threads[ t ] , NULL );
+	for ( int r = 0 ; r < g_readers ; ++r )
+		check( readers[ r ].ok , "readers only see sorted keys and whole updates" );
+	for ( int w = 0 ; w < g_writers ; ++w )
+		ref.insert( writers[ w ].ref.begin() , writers[ w ].ref.end() );
+
+	std::vector< std::pair< int , int > >	all;
+	collect									f = { &all };
+
+	m.for_each_ordered( f );
+	check( m.size() == ref.size() && ref_type( all.begin() , all.end() ) == ref , "final content is what every writer did" );
+	cout << "concurrent_map with " << g_writers << " writers and " << g_readers << " readers: done\n";
+}
+
+int main( void )
+{
+	std_map_tests();
+	threaded_tests();
+	return ( checks_result() );
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_flat_map.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:58:12 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../Includes/Containers/flat_map.hpp"
+#include "test_utils.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <map>
+
+using std::cout;
+
+//  Mapped type without operator== : copying a flat_map must not need one  //
+struct no_equal
+{
+	int	v;
+
+	no_equal( int x = 0 ) : v( x ) {}
+};
+
+//  Bulk builds keep the first of equal keys, as std::map does  //
+static void	bulk_tests()
+{
+	cout << "--- flat_map bulk build ---\n";
+	std::vector< ft::pair< int , int > >	input;
+	std::vector< std::pair< int , int > >	std_input;
+
+	std::srand( 7 );
+	for ( int i = 0 ; i < 20000 ; ++i )
+	{
+		int	k = std::rand() % 6000;
+
+		input.push_back( ft::make_pair( k , i ) );
+		std_input.push_back( std::make_pair( k , i ) );
+	}
+
+	ft::flat_map< int , int >	m( input.begin() , input.end() );
+	std::map< int , int >		ref( std_input.begin() , std_input.end() );
+
+	check( same_content( m , ref ) , "range constructor sorts and keeps the first of equal keys" );
+	for ( std::size_t i = 0 ; i < input.size() ; ++i )
+	{
+		input[ i ].first += 3000;
+		input[ i ].second = -input[ i ].second;
+		std_input[ i ].first += 3000;
+		std_input[ i ].second = -std_input[ i ].second;
+	}
+	m.insert( input.begin() , input.end() );
+	ref.insert( std_input.begin() , std_input.end() );
+	check( same_content( m , ref ) , "range insert merges, existing elements win" );
+
+	ft::flat_map< int , int >	sorted( ft::sorted_unique , m.begin() , m.end() );
+
+	check( same_content( sorted , ref ) , "sorted_unique constructor copies as is" );
+	cout << "flat_map bulk build: done\n";
+}
+
+//  Random single operations, replayed on std::map  //
+static void	std_map_tests()
+{
+	cout << "--- flat_map against std::map ---\n";
+	ft::flat_map< int , int >	m;
+	std::map< int , int >		ref;
+
+	std::srand( 42 );
+	for ( int round = 0 ; round < 30000 ; ++round )
+	{
+		int	k = std::rand() % 3000;
+		int	op = std::rand() % 7;
+
+		if ( op < 2 )
+			check( m.insert( ft::make_pair( k , round ) ).second == ref.insert( std::make_pair( k , round ) ).second , "insert() reports the same" );
+		else if ( op == 2 )
+		{
+			m[ k ] += round;
+			ref[ k ] += round;
+		}
+		else if ( op == 3 )
+			check( m.erase( k ) == ref.erase( k ) , "erase( key ) count" );
+		else if ( op == 4 )
+		{
+			int	hi = k + std::rand() % 50;
+
+			m.erase( m.lower_bound( k ) , m.lower_bound( hi ) );
+			ref.erase( ref.lower_bound( k ) , ref.lower_bound( hi ) );
+		}
+		else
+		{
+			check( m.count( k ) == ref.count( k ) , "count()" );
+			check( ( m.lower_bound( k ) == m.end() ) == ( ref.lower_bound( k ) == ref.end() ) , "lower_bound() at end" );
+			check( m.upper_bound( k ) - m.lower_bound( k ) == std::distance( ref.lower_bound( k ) , ref.upper_bound( k ) ) , "bounds" );
+		}
+	}
+	check( same_content( m , ref ) , "final content" );
+	cout << "flat_map against std::map: done\n";
+}
+
+//  Copies of maps whose values are std types, or have no operator==  //
+static void	copy_tests()
+{
+	cout << "--- flat_map copies ---\n";
+	ft::flat_map< std::string , std::string >	a;
+	ft::flat_map< std::string , std::string >	b;
+
+	a[ "one" ] = "1";
+	a[ "two" ] = "2";
+	b[ "three" ] = "3";
+	b = a;
+	b = b;
+	check( b.size() == 2 && b[ "two" ] == "2" && b == a , "operator= over std::string" );
+
+	ft::flat_map< int , no_equal >	c;
+
+	for ( int i = 0 ; i < 100 ; ++i )
+		c[ i ] = no_equal( i * 2 );
+
+	ft::flat_map< int , no_equal >	d( c );
+	ft::flat_map< int , no_equal >	e;
+
+	e = c;
+	check( d.size() == 100 && e.size() == 100 && e[ 42 ].v == 84 && d[ 99 ].v == 198 , "copies without mapped_type::operator==" );
+	cout << "flat_map copies: done\n";
+}
+
+int main( void )
+{
+	bulk_tests();
+	std_map_tests();
+	copy_tests();
+	return ( checks_result() );
+}
@@ -0,0 +1,319 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_hash_tables.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:52:40 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <stdexcept>
+#include <map>
+
+#include "../Includes/Containers/unordered_map.hpp"
+#include "../Includes/Containers/flat_hash_map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  Random insert / erase / operator[] / find, mirrored on std::map  //
+template< class Map >
+static void	differential_tests( const char* name )
+{
+	cout << "--- " << name << " vs std::map ---\n";
+	Map						m;
+	std::map< int , int >	ref;
+	bool					ok = true;
+
+	for ( int i = 0 ; i < 40000 ; i++ )
+	{
+		int	k = next_rand( 3000 );
+		int	v = next_rand( 1000 );
+
+		switch ( next_rand( 5 ) )
+		{
+			case 0:
+				ok &= ( m.insert( ft::make_pair( k , v ) ).second == ref.insert( std::make_pair( k , v ) ).second );
+				break ;
+			case 1:
+				ok &= ( m.erase( k ) == ref.erase( k ) );
+				break ;
+			case 2:
+				m[k] += v;
+				ref[k] += v;
+				break ;
+			case 3:
+			{
+				typename Map::iterator	it = m.find( k );
+
+				if ( it != m.end() )
+				{
+					m.erase( it );
+					ref.erase( k );
+				}
+				ok &= ( m.find( k ) == m.end() );
+				break ;
+			}
+			default:
+			{
+				typename Map::iterator	it = m.find( k );
+
+				ok &= ( it == m.end() ? !ref.count( k ) : ref.count( k ) && ref[k] == it->second );
+			}
+		}
+		if ( i % 5000 == 0 )
+			ok &= same_elements( m , ref );
+	}
+	check( ok , "random operations" );
+	check( same_elements( m , ref ) , "content after random operations" );
+
+	//  Erasing while walking : erase() hands back the element that took the slot  //
+	for ( typename Map::iterator it = m.begin() ; it != m.end() ; )
+	{
+		if ( it->first % 3 == 0 )
+			it = m.erase( it );
+		else
+			++it;
+	}
+	for ( std::map< int , int >::iterator it = ref.begin() ; it != ref.end() ; )
+	{
+		if ( it->first % 3 == 0 )
+			ref.erase( it++ );
+		else
+			++it;
+	}
+	check( same_elements( m , ref ) , "erase( iterator ) while iterating" );
+
+	typename Map::size_type	buckets = m.bucket_count();
+
+	m.rehash( buckets * 4 );
+	check( m.bucket_count() >= buckets * 4 && same_elements( m , ref ) , "rehash() to a larger table" );
+	m.rehash( 0 );
+	check( m.load_factor() <= m.max_load_factor() && same_elements( m , ref ) , "rehash( 0 )" );
+
+	Map	r;
+
+	r.reserve( 5000 );
+	buckets = r.bucket_count();
+	for ( int i = 0 ; i < 5000 ; i++ )
+		r[i] = i;
+	check( r.bucket_count() == buckets && r.size() == 5000 , "reserve() : no growth up to n elements" );
+
+	Map	c( m );
+
+	check( c == m && same_elements( c , ref ) , "copy constructor" );
+	c[-1] = 0;
+	check( c != m && m.count( -1 ) == 0 , "copy is independent" );
+	c.swap( r );
+	check( c.size() == 5000 && r.size() == ref.size() + 1 , "swap()" );
+	r.clear();
+	check( r.empty() && r.begin() == r.end() && r.find( 1 ) == r.end() , "clear()" );
+	cout << name << " vs std::map: done\n";
+}
+
+//  Copies left before one throws, -1 for never  //
+static int	g_copies_left = -1;
+
+struct thrower
+{
+	int	value;
+
+	thrower( int v = 0 ) : value( v ) {}
+	thrower( const thrower& x ) : value( x.value )
+	{
+		if ( g_copies_left >= 0 && g_copies_left-- == 0 )
+			throw ( std::runtime_error( "thrower" ) );
+	}
+};
+
+//  Eight keys per hash : inserts and erases shift long runs  //
+struct group_hash
+{
+	std::size_t	operator()( int k ) const
+	{
+		return ( static_cast< std::size_t >( k / 8 ) );
+	}
+};
+
+typedef ft::unordered_map< int , thrower , group_hash >	throwing_map;
+
+//  Every element reached by iteration is found by its key, and the keys of ref missing are counted in lost  //
+static bool	searchable( const throwing_map& m , const std::map< int , int >& ref , std::size_t& lost )
+{
+	std::size_t	seen = 0;
+
+	for ( throwing_map::const_iterator it = m.begin() ; it != m.end() ; ++it , ++seen )
+	{
+		if ( m.find( it->first ) != it || it->second.value != it->first )
+			return ( false );
+	}
+	lost = 0;
+	for ( std::map< int , int >::const_iterator it = ref.begin() ; it != ref.end() ; ++it )
+		lost += ( m.find( it->first ) == m.end() );
+	return ( seen == m.size() && m.size() + lost == ref.size() );
+}
+
+//  A copy throwing while values shift must not leave a hole in a run : the values after it would be lost to lookups  //
+static void	unordered_map_throwing_copy_tests()
+{
+	cout << "--- unordered_map throwing copies ---\n";
+	throwing_map			m;
+	std::map< int , int >	ref;
+	std::size_t				lost = 0;
+	int						thrown = 0;
+	bool					ok = true;
+
+	m.reserve( 2000 );
+	for ( int k = 0 ; k < 1600 ; k++ )
+	{
+		if ( k % 8 != 7 )
+		{
+			m[k] = thrower( k );
+			ref[k] = k;
+		}
+	}
+	for ( int k = 7 ; k < 1600 ; k += 8 )
+	{
+		const throwing_map::value_type	val( k , thrower( k ) );
+
+		g_copies_left = k % 5;
+		try
+		{
+			m.insert( val );
+			ref[k] = k;
+		}
+		catch ( std::runtime_error& )
+		{
+			++thrown;
+		}
+		g_copies_left = -1;
+		ok = ok && searchable( m , ref , lost ) && !lost;
+	}
+	check( thrown > 50 && ok , "insert() puts shifted values back" );
+	thrown = 0;
+	for ( int k = 0 ; k < 1600 ; k += 3 )
+	{
+		g_copies_left = k % 4;
+		try
+		{
+			ref.erase( k );
+			m.erase( k );
+		}
+		catch ( std::runtime_error& )
+		{
+			++thrown;
+		}
+		g_copies_left = -1;
+		ok = ok && searchable( m , ref , lost ) && lost <= 1;
+		for ( std::map< int , int >::iterator it = ref.begin() ; lost && it != ref.end() ; )
+		{
+			if ( m.find( it->first ) == m.end() )
+				ref.erase( it++ );
+			else
+				++it;
+		}
+	}
+	check( thrown > 50 && ok , "erase() keeps the run searchable, at most the value that threw is lost" );
+	cout << "unordered_map throwing copies: done\n";
+}
+
+//  Erase one, insert another : deleted slots must be reclaimed, not pile up until the table grows  //
+static void	flat_hash_map_churn_tests()
+{
+	cout << "--- flat_hash_map churn ---\n";
+	ft::flat_hash_map< int , int >	m;
+	std::map< int , int >			ref;
+
+	for ( int i = 0 ; i < 1000 ; i++ )
+	{
+		m[i] = i;
+		ref[i] = i;
+	}
+
+	ft::flat_hash_map< int , int >::size_type	buckets = m.bucket_count();
+
+	for ( int i = 1000 ; i < 200000 ; i++ )
+	{
+		m.erase( i - 1000 );
+		ref.erase( i - 1000 );
+		m[i] = i;
+		ref[i] = i;
+	}
+	check( m.bucket_count() == buckets , "bucket_count() steady under churn" );
+	check( same_elements( m , ref ) , "content after churn" );
+	m.erase( m.begin() , m.end() );
+	check( m.empty() && m.begin() == m.end() , "erase( begin() , end() )" );
+	m.rehash( 0 );
+	check( m.bucket_count() < buckets , "rehash( 0 ) drops deleted slots" );
+	cout << "flat_hash_map churn: done\n";
+}
+
+//  Every key hashes the same : no table size can spread them  //
+struct zero_hash
+{
+	std::size_t	operator()( int ) const
+	{
+		return ( 0 );
+	}
+};
+
+static void	unordered_map_degenerate_tests()
+{
+	cout << "--- unordered_map degenerate hash ---\n";
+	ft::unordered_map< int , int , zero_hash >	m;
+	int											n = 0;
+	bool										thrown = false;
+
+	try
+	{
+		for ( ; n < 1000 ; n++ )
+			m[n] = n;
+	}
+	catch ( std::length_error& )
+	{
+		thrown = true;
+	}
+	check( thrown && n == 254 , "length_error once 255 keys share a hash" );
+	check( m.size() == static_cast< std::size_t >( n ) && m.bucket_count() <= 1024 , "table kept, without runaway growth" );
+	for ( int i = 0 ; i < n ; i++ )
+		check( m.find( i ) != m.end() && m[i] == i , "keys kept after length_error" );
+	m.erase( 3 );
+	m[1000] = 1;
+	check( m.size() == static_cast< std::size_t >( n ) && m.count( 1000 ) && !m.count( 3 ) , "erase then insert again" );
+
+	ft::unordered_map< int , int >	u;
+	const float						bad[] = { 0.f , -1.f };
+
+	for ( int i = 0 ; i < 2 ; i++ )
+	{
+		thrown = false;
+		try
+		{
+			u.max_load_factor( bad[i] );
+		}
+		catch ( std::invalid_argument& )
+		{
+			thrown = true;
+		}
+		check( thrown && u.max_load_factor() > 0 , "max_load_factor rejects non positive values" );
+	}
+	u.max_load_factor( 0.5f );
+	for ( int i = 0 ; i < 1000 ; i++ )
+		u[i] = i;
+	check( u.size() == 1000 && u.load_factor() <= 0.5f , "max_load_factor( 0.5 )" );
+	cout << "unordered_map degenerate hash: done\n";
+}
+
+int main( void )
+{
+	differential_tests< ft::unordered_map< int , int > >( "unordered_map" );
+	differential_tests< ft::flat_hash_map< int , int > >( "flat_hash_map" );
+	unordered_map_degenerate_tests();
+	unordered_map_throwing_copy_tests();
+	flat_hash_map_churn_tests();
+	return ( checks_result() );
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_order_statistics.cpp                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:06:45 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <iterator>
+#include <vector>
+#include <map>
+
+#include "../Includes/Containers/map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+typedef ft::map< int , int >	map_type;
+typedef std::map< int , int >	ref_type;
+
+//  statistics_match() : nth(), rank() and distance() give what a walk over std::map gives  //
+static bool	statistics_match( const map_type& m , const ref_type& ref )
+{
+	ref_type::const_iterator	sit = ref.begin();
+
+	if ( m.size() != ref.size() || m.nth( ref.size() ) != m.end() )
+		return ( false );
+	for ( std::size_t i = 0 ; i < ref.size() ; ++i , ++sit )
+	{
+		if ( m.nth( i )->first != sit->first || m.rank( sit->first ) != i || m.rank( sit->first + 1 ) != i + 1 )
+			return ( false );
+	}
+	return ( true );
+}
+
+//  Random inserts and erases, statistics read against std::map on the way  //
+static void	rank_select_tests()
+{
+	cout << "--- map rank and select ---\n";
+	map_type	m;
+	ref_type	ref;
+
+	std::srand( 16 );
+	for ( int round = 0 ; round < 40000 ; ++round )
+	{
+		int	k = std::rand() % 4000;
+		int	op = std::rand() % 5;
+
+		if ( op < 2 )
+		{
+			m.insert( ft::make_pair( k , round ) );
+			ref.insert( std::make_pair( k , round ) );
+		}
+		else if ( op == 2 )
+		{
+			m.erase( k );
+			ref.erase( k );
+		}
+		else if ( op == 3 )
+		{
+			int	hi = k + std::rand() % 30;
+
+			m.erase( m.lower_bound( k ) , m.lower_bound( hi ) );
+			ref.erase( ref.lower_bound( k ) , ref.lower_bound( hi ) );
+		}
+		else
+		{
+			std::size_t	below = std::distance( ref.begin() , ref.lower_bound( k ) );
+			int			hi = k + std::rand() % 500;
+
+			check( m.rank( k ) == below , "rank() counts the keys before k" );
+			check( ft::distance( m.lower_bound( k ) , m.lower_bound( hi ) ) == \
+					std::distance( ref.lower_bound( k ) , ref.lower_bound( hi ) ) , "distance() between map iterators" );
+			if ( !ref.empty() )
+			{
+				std::size_t					i = std::rand() % ref.size();
+				ref_type::const_iterator	sit = ref.begin();
+
+				std::advance( sit , i );
+				check( m.nth( i )->first == sit->first , "nth() is the i-th key" );
+			}
+		}
+		if ( round % 8000 == 0 )
+			check( statistics_match( m , ref ) , "every index and rank" );
+	}
+	check( statistics_match( m , ref ) , "every index and rank at the end" );
+	cout << "map rank and select: done\n";
+}
+
+//  Sizes must also be right in maps that were bulk built, copied or assigned  //
+static void	built_tests()
+{
+	cout << "--- map rank and select after bulk builds ---\n";
+	std::vector< ft::pair< int , int > >	input;
+	ref_type								ref;
+
+	for ( int i = 0 ; i < 5000 ; ++i )
+	{
+		input.push_back( ft::make_pair( i * 3 , i ) );
+		ref.insert( std::make_pair( i * 3 , i ) );
+	}
+
+	map_type	built( input.begin() , input.end() );
+	map_type	copy( built );
+	map_type	assigned;
+
+	assigned = copy;
+	check( statistics_match( built , ref ) , "range constructor" );
+	check( statistics_match( copy , ref ) , "copy constructor" );
+	check( statistics_match( assigned , ref ) , "operator=" );
+	check( built.rank( -1 ) == 0 && built.rank( 15000 ) == 5000 && built.rank( 4 ) == 2 , "rank() outside and between keys" );
+	check( ft::distance( built.begin() , built.end() ) == 5000 && ft::distance( built.end() , built.end() ) == 0 , "distance() over the whole map" );
+	cout << "map rank and select after bulk builds: done\n";
+}
+
+int main( void )
+{
+	rank_select_tests();
+	built_tests();
+	return ( checks_result() );
+}
@@ -0,0 +1,277 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_persistent_map.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:35:08 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include <map>
+#include <pthread.h>
+
+#include "../Includes/Containers/persistent_map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  Allocator counting the bytes it has handed out and not yet taken back  //
+static long	g_live = 0;
+
+template< class T >
+class counting_allocator : public std::allocator< T >
+{
+	public :
+
+		template< class U >
+		struct rebind
+		{
+			typedef counting_allocator< U >	other;
+		};
+
+		counting_allocator( void ) {}
+		counting_allocator( const counting_allocator& x ) : std::allocator< T >( x ) {}
+		template< class U >
+		counting_allocator( const counting_allocator< U >& x ) : std::allocator< T >( x ) {}
+
+		T*	allocate( std::size_t n , const void* = 0 )
+		{
+			__sync_fetch_and_add( &g_live , static_cast< long >( n * sizeof( T ) ) );
+			return ( std::allocator< T >::allocate( n ) );
+		}
+
+		void	deallocate( T* p , std::size_t n )
+		{
+			__sync_fetch_and_sub( &g_live , static_cast< long >( n * sizeof( T ) ) );
+			std::allocator< T >::deallocate( p , n );
+			return ;
+		}
+};
+
+typedef ft::persistent_map< int , int , std::less< int > , counting_allocator< ft::pair< const int , int > > >	map_type;
+typedef std::map< int , int >																					ref_type;
+
+//  insert() builds its iterator from the descent it inserts along, rotations included : the path must walk as std::map's  //
+static bool	walks_like( const map_type& m , map_type::iterator it , const ref_type& ref , int k )
+{
+	ref_type::const_iterator	rit = ref.find( k );
+	ref_type::const_iterator	next = rit;
+	map_type::iterator			prev = it;
+
+	if ( it->first != k || it->second != rit->second )
+		return ( false );
+	for ( ++it , ++next ; next != ref.end() ; ++it , ++next )
+	{
+		if ( it == m.end() || it->first != next->first )
+			return ( false );
+	}
+	if ( it != m.end() )
+		return ( false );
+	while ( rit != ref.begin() )
+	{
+		--rit;
+		--prev;
+		if ( prev->first != rit->first )
+			return ( false );
+	}
+	return ( true );
+}
+
+static void	insert_path_tests()
+{
+	cout << "--- persistent_map insert() iterators ---\n";
+	const long	start = g_live;
+	bool		ok = true;
+
+	for ( int order = 0 ; order < 4 ; ++order )
+	{
+		map_type	m;
+		ref_type	ref;
+		map_type	before;
+		ref_type	ref_before;
+
+		std::srand( 190 + order );
+		for ( int i = 0 ; i < 1500 ; ++i )
+		{
+			int	k = ( order == 0 ) ? i : ( order == 1 ) ? -i : ( order == 2 ) ? ( ( i % 2 ) ? i : 3000 - i ) : std::rand() % 3000;
+
+			if ( i % 100 == 0 )
+			{
+				ok = ok && same_both_ways( before , ref_before );
+				before = m.snapshot();
+				ref_before = ref;
+			}
+
+			ft::pair< map_type::iterator , bool >	ret = m.insert( ft::make_pair( k , i ) );
+
+			ok = ok && ret.second == ref.insert( std::make_pair( k , i ) ).second;
+			ok = ok && ( i % 25 ? ret.first->first == k : walks_like( m , ret.first , ref , k ) );
+		}
+		for ( int i = 0 ; i < 500 ; ++i )
+		{
+			int	k = std::rand() % 4000;
+
+			m[ k ] = -k;
+			ref[ k ] = -k;
+		}
+		ok = ok && same_both_ways( m , ref ) && same_both_ways( before , ref_before );
+	}
+	check( ok , "insert() iterator and operator[] along every rotation" );
+	check( g_live == start , "no node left behind" );
+	cout << "persistent_map insert() iterators: done\n";
+}
+
+//  Snapshots taken along random writes keep what the map held when they were taken  //
+static void	snapshot_tests()
+{
+	cout << "--- persistent_map snapshots ---\n";
+	const long	start = g_live;
+
+	{
+		map_type				m;
+		ref_type				ref;
+		std::vector< map_type >	snapshots;
+		std::vector< ref_type >	refs;
+
+		std::srand( 19 );
+		for ( int round = 0 ; round < 30000 ; ++round )
+		{
+			int	k = std::rand() % 2000;
+			int	op = std::rand() % 10;
+
+			if ( op < 3 )
+				check( m.insert( ft::make_pair( k , round ) ).second == ref.insert( std::make_pair( k , round ) ).second , "insert() reports the same" );
+			else if ( op < 5 )
+			{
+				m[ k ] += round;
+				ref[ k ] += round;
+			}
+			else if ( op < 7 )
+				check( m.erase( k ) == ref.erase( k ) , "erase( key ) count" );
+			else if ( op == 7 )
+			{
+				int	hi = k + std::rand() % 40;
+
+				m.erase( m.lower_bound( k ) , m.lower_bound( hi ) );
+				ref.erase( ref.lower_bound( k ) , ref.lower_bound( hi ) );
+			}
+			else if ( op == 8 && snapshots.size() < 25 )
+			{
+				snapshots.push_back( m.snapshot() );
+				refs.push_back( ref );
+			}
+			else if ( !snapshots.empty() )
+			{
+				std::size_t	i = std::rand() % snapshots.size();
+
+				check( same_both_ways( snapshots[ i ] , refs[ i ] ) , "snapshot unchanged by later writes" );
+				snapshots.erase( snapshots.begin() + i );
+				refs.erase( refs.begin() + i );
+			}
+		}
+		check( same_both_ways( m , ref ) , "final content" );
+		for ( std::size_t i = 0 ; i < snapshots.size() ; ++i )
+			check( same_both_ways( snapshots[ i ] , refs[ i ] ) , "remaining snapshots" );
+
+		map_type	copy( m );
+		map_type	assigned;
+
+		assigned = m;
+		m.clear();
+		check( same_both_ways( copy , ref ) && same_both_ways( assigned , ref ) && copy == assigned , "copies survive clear() of the source" );
+	}
+	check( g_live == start , "every node freed once no version holds it" );
+	cout << "persistent_map snapshots: done\n";
+}
+
+//  One snapshot per reader thread, read while the writer keeps going  //
+struct reader_job
+{
+	map_type	snapshot;
+	ref_type	ref;
+	bool		same;
+};
+
+static void*	reader( void* arg )
+{
+	reader_job*	job = static_cast< reader_job* >( arg );
+
+	job->same = true;
+	for ( int pass = 0 ; pass < 4 ; ++pass )
+		job->same = job->same && same_both_ways( job->snapshot , job->ref );
+	job->snapshot.clear();
+	return ( NULL );
+}
+
+static void	threaded_snapshot_tests()
+{
+	cout << "--- persistent_map snapshots read by other threads ---\n";
+	const long	start = g_live;
+
+	{
+		map_type	m;
+		ref_type	ref;
+		reader_job	jobs[ 4 ];
+		pthread_t	threads[ 4 ];
+
+		std::srand( 91 );
+		for ( int i = 0 ; i < 20000 ; ++i )
+		{
+			int	k = std::rand() % 50000;
+
+			m[ k ] = i;
+			ref[ k ] = i;
+		}
+		for ( int turn = 0 ; turn < 6 ; ++turn )
+		{
+			for ( int t = 0 ; t < 4 ; ++t )
+			{
+				jobs[ t ].snapshot = m.snapshot();
+				jobs[ t ].ref = ref;
+				if ( pthread_create( &threads[ t ] , NULL , reader , &jobs[ t ] ) )
+				{
+					cout << "KO: pthread_create()\n";
+					std::exit( 1 );
+				}
+				for ( int i = 0 ; i < 2000 ; ++i )
+				{
+					int	k = std::rand() % 50000;
+
+					if ( std::rand() & 1 )
+					{
+						m.erase( k );
+						ref.erase( k );
+					}
+					else
+					{
+						m[ k ] += 1;
+						ref[ k ] += 1;
+					}
+				}
+			}
+			for ( int t = 0 ; t < 4 ; ++t )
+			{
+				pthread_join( threads[ t ] , NULL );
+				check( jobs[ t ].same , "snapshot unchanged while the writer goes on" );
+			}
+		}
+		check( same_both_ways( m , ref ) , "writer content" );
+	}
+	check( g_live == start , "every node freed once readers and writer are done" );
+	cout << "persistent_map snapshots read by other threads: done\n";
+}
+
+int main( void )
+{
+	insert_path_tests();
+	snapshot_tests();
+	threaded_snapshot_tests();
+	return ( checks_result() );
+}
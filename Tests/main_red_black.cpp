@@ -0,0 +1,377 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_red_black.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:56:20 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 15:21:40 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <map>
+
+#include "../Includes/Containers/map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+typedef ft::tree< const int , int >		tree_type;
+typedef tree_type::basePtr				basePtr;
+typedef ft::map< int , int >			map_type;
+typedef std::map< int , int >			ref_type;
+
+/* -------------------------------------------------------------------------- */
+/*                      INVARIANTS                                            */
+/* -------------------------------------------------------------------------- */
+
+//  Trees are driven directly : their destructor leaves the nodes to the owner, every test clear()s them  //
+
+//  black_height() : black nodes down to a NULL leaf (counted), -1 if a rule is broken below current  //
+//  Rules : parent links, keys strictly between lo and hi, no red child of a red node, equal black  //
+//  heights on both sides, subtree size  //
+static int	black_height( const tree_type& t , basePtr current , basePtr parent , const int* lo , const int* hi )
+{
+	int		left;
+	int		right;
+
+	if ( !current )
+		return ( 1 );
+	const int&	k = tree_type::key( current );
+
+	if ( current->parent != parent || ( lo && !( *lo < k ) ) || ( hi && !( k < *hi ) ) )
+		return ( -1 );
+	if ( t.is_red( current ) && ( t.is_red( current->left ) || t.is_red( current->right ) ) )
+		return ( -1 );
+	left = black_height( t , current->left , current , lo , &k );
+	right = black_height( t , current->right , current , &k , hi );
+	if ( left < 0 || left != right )
+		return ( -1 );
+	if ( current->size != ft::node_base::subtree_size( current->left ) + ft::node_base::subtree_size( current->right ) + 1 )
+		return ( -1 );
+	return ( left + ( current->color == ft::rb_black ) );
+}
+
+//  valid() : red-black tree with a black root, and a header pointing at root, smallest and biggest node  //
+static bool	valid( const tree_type& t )
+{
+	basePtr	root = t.root();
+
+	if ( !root )
+		return ( t.size() == 0 && t.begin() == t.end() && t.leftmost() == t.end() && t.rightmost() == t.end() );
+	return ( root->color == ft::rb_black && root->parent == t.end() && root->size == t.size()
+		&& black_height( t , root , t.end() , NULL , NULL ) > 0
+		&& t.leftmost() == ft::node_base::minimum( root ) && t.rightmost() == ft::node_base::maximum( root )
+		&& t.begin() == t.leftmost() );
+}
+
+//  same_tree() : in order walk of t gives ref, both ways  //
+static bool	same_tree( const tree_type& t , const ref_type& ref )
+{
+	basePtr						current = t.begin();
+	ref_type::const_iterator	it = ref.begin();
+
+	if ( t.size() != ref.size() )
+		return ( false );
+	for ( ; it != ref.end() ; ++it , current = ft::node_base::increment( current ) )
+	{
+		if ( current == t.end() || tree_type::key( current ) != it->first || static_cast< tree_type::nodePtr >( current )->couple.second != it->second )
+			return ( false );
+	}
+	if ( current != t.end() )
+		return ( false );
+	for ( ref_type::const_reverse_iterator rit = ref.rbegin() ; rit != ref.rend() ; ++rit )
+	{
+		current = ft::node_base::decrement( current );
+		if ( tree_type::key( current ) != rit->first )
+			return ( false );
+	}
+	return ( true );
+}
+
+//  same_shape() : node for node, same keys, values and colors  //
+static bool	same_shape( basePtr x , basePtr y )
+{
+	if ( !x || !y )
+		return ( x == y );
+	return ( tree_type::key( x ) == tree_type::key( y ) && x->color == y->color
+		&& same_shape( x->left , y->left ) && same_shape( x->right , y->right ) );
+}
+
+/* -------------------------------------------------------------------------- */
+/*                      TREE                                                  */
+/* -------------------------------------------------------------------------- */
+
+//  node_at() : i-th node in key order, walked from begin()  //
+static basePtr	node_at( const tree_type& t , std::size_t i )
+{
+	basePtr	current = t.begin();
+
+	while ( i-- )
+		current = ft::node_base::increment( current );
+	return ( current );
+}
+
+//  fill() : n random keys of sign taken from [0, range[, in t and ref  //
+static void	fill( tree_type& t , ref_type& ref , int n , int range , int sign )
+{
+	for ( int i = 0 ; i < n ; i++ )
+	{
+		int	k = sign * ( std::rand() % range );
+
+		t.insert( ft::make_pair( k , i ) );
+		ref.insert( std::make_pair( k , i ) );
+	}
+	return ;
+}
+
+//  Random insert, insert_hint (good, end() and wrong hints), erase and erase_node, replayed on std::map  //
+static void	random_tests( void )
+{
+	cout << "--- tree insert / erase ---\n";
+	tree_type	t;
+	ref_type	ref;
+	bool		ok = true;
+
+	std::srand( 10 );
+	for ( int i = 0 ; i < 40000 && ok ; i++ )
+	{
+		int	k = std::rand() % 3000;
+		int	op = std::rand() % 6;
+
+		if ( op == 0 )
+			t.insert( ft::make_pair( k , i ) );
+		else if ( op == 1 )
+			t.insert_hint( t.lower_bound( k ) , ft::make_pair( k , i ) );
+		else if ( op == 2 )
+			t.insert_hint( ( std::rand() % 2 || t.empty() ) ? t.end() : node_at( t , std::rand() % t.size() ) , ft::make_pair( k , i ) );
+		else if ( op == 3 )
+			ok = ( t.erase( k ) == ( ref.erase( k ) == 1 ) );
+		else if ( !t.empty() )
+		{
+			basePtr	victim = node_at( t , std::rand() % t.size() );
+
+			ref.erase( tree_type::key( victim ) );
+			t.erase_node( victim );
+		}
+		if ( op < 3 )
+			ref.insert( std::make_pair( k , i ) );
+		ok = ok && valid( t ) && ( i % 500 || same_tree( t , ref ) );
+	}
+	check( ok , "red-black rules along random operations" );
+	check( ok && same_tree( t , ref ) , "final tree" );
+	while ( ok && !t.empty() )
+	{
+		ref.erase( tree_type::key( t.begin() ) );
+		t.erase_node( t.begin() );
+		ok = valid( t ) && ( t.size() % 97 || same_tree( t , ref ) );
+	}
+	check( ok && valid( t ) , "erase_node() of the smallest down to empty" );
+	t.clear();
+	cout << "tree insert / erase: done\n";
+}
+
+//  Hints in ascending, descending and interleaved order : the hint is right every time  //
+static void	hint_tests( void )
+{
+	cout << "--- tree insert_hint ---\n";
+	tree_type	up;
+	tree_type	down;
+	tree_type	inside;
+	ref_type	ref;
+	basePtr		hint;
+
+	for ( int i = 0 ; i < 5000 ; i++ )
+	{
+		up.insert_hint( up.end() , ft::make_pair( i , i ) );
+		ref[i] = i;
+	}
+	hint = down.end();
+	for ( int i = 4999 ; i >= 0 ; i-- )
+		hint = down.insert_hint( hint , ft::make_pair( i , i ) ).first;
+	for ( int i = 0 ; i < 5000 ; i += 2 )
+		inside.insert_hint( inside.end() , ft::make_pair( i , i ) );
+	for ( int i = 1 ; i < 5000 ; i += 2 )
+		inside.insert_hint( inside.lower_bound( i ) , ft::make_pair( i , i ) );
+	check( valid( up ) && same_tree( up , ref ) , "end() hints, ascending" );
+	check( valid( down ) && same_tree( down , ref ) , "hints on the last inserted, descending" );
+	check( valid( inside ) && same_tree( inside , ref ) , "hints between two nodes" );
+	check( down.insert_hint( down.search( 42 ) , ft::make_pair( 42 , -1 ) ).second == false && same_tree( down , ref ) , "hint on an equal key" );
+	up.clear();
+	down.clear();
+	inside.clear();
+	cout << "tree insert_hint: done\n";
+}
+
+//  build_sorted() for every size up to a few full levels, sorted, with duplicates and with an unsorted tail  //
+static void	build_tests( void )
+{
+	cout << "--- tree build_sorted ---\n";
+	bool	ok = true;
+
+	for ( int n = 0 ; n < 140 && ok ; n++ )
+	{
+		std::vector< ft::pair< int , int > >	sorted;
+		std::vector< ft::pair< int , int > >	doubled;
+		std::vector< ft::pair< int , int > >	tail;
+		ref_type								ref;
+		ref_type								ref_tail;
+
+		for ( int i = 0 ; i < n ; i++ )
+		{
+			sorted.push_back( ft::make_pair( i * 2 , i ) );
+			doubled.push_back( ft::make_pair( i * 2 , i ) );
+			doubled.push_back( ft::make_pair( i * 2 , -i ) );
+			tail.push_back( ft::make_pair( ( i < n / 2 ) ? i * 2 : ( n - i ) * 2 - 1 , i ) );
+			ref[i * 2] = i;
+			ref_tail.insert( std::make_pair( tail.back().first , i ) );
+		}
+
+		tree_type	trusted;
+		tree_type	checked;
+		tree_type	mixed;
+
+		trusted.build_sorted( sorted.begin() , sorted.end() , true );
+		checked.build_sorted( doubled.begin() , doubled.end() , false );
+		mixed.build_sorted( tail.begin() , tail.end() , false );
+		ok = ok && valid( trusted ) && same_tree( trusted , ref );
+		ok = ok && valid( checked ) && same_tree( checked , ref );
+		ok = ok && valid( mixed ) && same_tree( mixed , ref_tail );
+		if ( ok )
+		{
+			trusted.insert( ft::make_pair( -1 , 0 ) );
+			trusted.erase( n );
+			ok = valid( trusted );
+		}
+		trusted.clear();
+		checked.clear();
+		mixed.clear();
+	}
+	check( ok , "build_sorted() of sizes 0 to 139" );
+	cout << "tree build_sorted: done\n";
+}
+
+//  assign() copies shape and colors into a tree of any size  //
+static void	assign_tests( void )
+{
+	cout << "--- tree assign ---\n";
+	tree_type	a;
+	tree_type	b;
+	tree_type	c;
+	tree_type	empty;
+	ref_type	ref_a;
+	ref_type	ref_b;
+
+	std::srand( 11 );
+	fill( a , ref_a , 3000 , 5000 , 1 );
+	fill( b , ref_b , 1000 , 5000 , -1 );
+	c.assign( a );
+	check( valid( c ) && same_tree( c , ref_a ) && same_shape( c.root() , a.root() ) , "assign() to an empty tree" );
+	c.assign( b );
+	check( valid( c ) && same_tree( c , ref_b ) && same_shape( c.root() , b.root() ) , "assign() over a bigger tree" );
+	c.assign( c );
+	check( valid( c ) && same_tree( c , ref_b ) , "self assign()" );
+	c.insert( ft::make_pair( 1 , 1 ) );
+	c.erase( tree_type::key( c.root() ) );
+	check( valid( c ) && valid( b ) , "copy and source still grow and shrink" );
+	c.assign( empty );
+	check( valid( c ) && c.empty() , "assign() of an empty tree" );
+	a.clear();
+	b.clear();
+	c.clear();
+	cout << "tree assign: done\n";
+}
+
+//  swap() exchanges headers : both sides stay valid, an empty side included  //
+static void	swap_tests( void )
+{
+	cout << "--- tree swap ---\n";
+	tree_type	a;
+	tree_type	b;
+	tree_type	empty;
+	ref_type	ref_a;
+	ref_type	ref_b;
+
+	std::srand( 12 );
+	fill( a , ref_a , 3000 , 5000 , 1 );
+	fill( b , ref_b , 1000 , 5000 , -1 );
+	a.swap( b );
+	check( valid( a ) && same_tree( a , ref_b ) && valid( b ) && same_tree( b , ref_a ) , "swap()" );
+	a.swap( empty );
+	check( valid( a ) && a.empty() && valid( empty ) && same_tree( empty , ref_b ) , "swap() with an empty tree" );
+	empty.insert( ft::make_pair( 1 , 1 ) );
+	b.erase( tree_type::key( b.begin() ) );
+	check( valid( empty ) && valid( b ) , "swapped trees still grow and shrink" );
+	b.clear();
+	check( valid( b ) && b.empty() , "clear()" );
+	empty.clear();
+	cout << "tree swap: done\n";
+}
+
+/* -------------------------------------------------------------------------- */
+/*                      MAP                                                   */
+/* -------------------------------------------------------------------------- */
+
+//  The same operations through ft::map, content read against std::map  //
+static void	map_tests( void )
+{
+	cout << "--- map vs std::map ---\n";
+	std::vector< ft::pair< int , int > >	sorted;
+	ref_type								ref;
+
+	for ( int i = 0 ; i < 2000 ; i++ )
+	{
+		sorted.push_back( ft::make_pair( i * 3 , i ) );
+		ref[i * 3] = i;
+	}
+
+	map_type	m( sorted.begin() , sorted.end() );
+	map_type	hinted;
+
+	check( same_both_ways( m , ref ) , "range constructor from sorted input" );
+	for ( int i = 5999 ; i >= 0 ; i-- )
+		if ( i % 3 == 0 )
+			hinted.insert( hinted.begin() , ft::make_pair( i , i / 3 ) );
+	check( same_both_ways( hinted , ref ) && hinted == m , "insert() with begin() hints" );
+
+	map_type	copy( m );
+	map_type	assigned;
+
+	assigned[ -1 ] = 0;
+	assigned = m;
+	check( same_both_ways( copy , ref ) && same_both_ways( assigned , ref ) , "copy constructor and operator=" );
+
+	std::srand( 13 );
+	for ( int i = 0 ; i < 1500 ; i++ )
+	{
+		map_type::iterator	it = copy.find( ( std::rand() % 2000 ) * 3 );
+
+		if ( it != copy.end() )
+		{
+			ref.erase( it->first );
+			copy.erase( it );
+		}
+	}
+	check( same_both_ways( copy , ref ) , "erase( iterator )" );
+	copy.erase( copy.begin() , copy.find( ref.rbegin()->first ) );
+	ref.erase( ref.begin() , --ref.end() );
+	check( same_both_ways( copy , ref ) , "erase( first , last )" );
+	copy.swap( assigned );
+	check( same_both_ways( assigned , ref ) && copy == m , "swap()" );
+	cout << "map vs std::map: done\n";
+}
+
+int main( void )
+{
+	random_tests();
+	hint_tests();
+	build_tests();
+	assign_tests();
+	swap_tests();
+	map_tests();
+	return ( checks_result() );
+}
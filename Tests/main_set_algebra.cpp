@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_set_algebra.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:48:05 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <algorithm>
+#include <iterator>
+#include <functional>
+#include <map>
+
+#include "../Includes/Containers/map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  std::set_* algorithms compare whole elements : only the keys must take part  //
+template< class Compare >
+struct key_less
+{
+	Compare	comp;
+
+	bool	operator()( const std::pair< const int , int >& x , const std::pair< const int , int >& y ) const
+	{
+		return ( this->comp( x.first , y.first ) );
+	}
+};
+
+//  Random keys in [0, range[ ; values in [0, 3[ so that shared keys often keep the same value  //
+template< class Compare >
+static void	fill( ft::map< int , int , Compare >& m , std::map< int , int , Compare >& ref , int n , int range )
+{
+	for ( int i = 0 ; i < n ; i++ )
+	{
+		int	k = next_rand( range );
+		int	v = next_rand( 3 );
+
+		m[k] = v;
+		ref[k] = v;
+	}
+	return ;
+}
+
+//  The std:: algorithms take the element from the first range when both hold a key : lhs wins, as in ft  //
+template< class Compare >
+static bool	check_pair( const ft::map< int , int , Compare >& a , const ft::map< int , int , Compare >& b , \
+	const std::map< int , int , Compare >& ra , const std::map< int , int , Compare >& rb )
+{
+	typedef std::map< int , int , Compare >	ref_map;
+	ref_map									u , i , d , added , removed , changed;
+	key_less< Compare >						less;
+	bool									ok = true;
+
+	std::set_union( ra.begin() , ra.end() , rb.begin() , rb.end() , std::inserter( u , u.end() ) , less );
+	std::set_intersection( ra.begin() , ra.end() , rb.begin() , rb.end() , std::inserter( i , i.end() ) , less );
+	std::set_difference( ra.begin() , ra.end() , rb.begin() , rb.end() , std::inserter( d , d.end() ) , less );
+	std::set_difference( rb.begin() , rb.end() , ra.begin() , ra.end() , std::inserter( added , added.end() ) , less );
+	for ( typename ref_map::const_iterator it = rb.begin() ; it != rb.end() ; ++it )
+	{
+		typename ref_map::const_iterator	from = ra.find( it->first );
+
+		if ( from != ra.end() && from->second != it->second )
+			changed.insert( *it );
+	}
+	removed = d;
+
+	ft::map< int , int , Compare >	fa , fr , fc;
+
+	ok &= same_content( ft::merge_union( a , b ) , u );
+	ok &= same_content( ft::intersection( a , b ) , i );
+	ok &= same_content( ft::difference( a , b ) , d );
+	ft::diff( a , b , fa , fr , fc );
+	ok &= same_content( fa , added ) && same_content( fr , removed ) && same_content( fc , changed );
+	return ( ok );
+}
+
+template< class Compare >
+static void	set_algebra_tests( const char* name )
+{
+	cout << "--- set algebra " << name << " ---\n";
+	const int	sizes[][2] = { { 0 , 0 } , { 0 , 50 } , { 50 , 0 } , { 1 , 1 } , { 100 , 100 } , { 1000 , 30 } , { 30 , 1000 } , { 3000 , 3000 } };
+	bool		ok = true;
+
+	for ( std::size_t s = 0 ; s < sizeof( sizes ) / sizeof( *sizes ) ; s++ )
+	{
+		for ( int round = 0 ; round < 4 ; round++ )
+		{
+			ft::map< int , int , Compare >	a , b;
+			std::map< int , int , Compare >	ra , rb;
+			int								range = 2 * ( sizes[s][0] > sizes[s][1] ? sizes[s][0] : sizes[s][1] ) + 1;
+
+			fill( a , ra , sizes[s][0] , range );
+			fill( b , rb , sizes[s][1] , range );
+			ok &= check_pair( a , b , ra , rb );
+		}
+	}
+	check( ok , "merge_union / intersection / difference / diff against std::set_*" );
+
+	ft::map< int , int , Compare >	a;
+	std::map< int , int , Compare >	ra;
+
+	fill( a , ra , 500 , 1000 );
+	check( same_content( ft::merge_union( a , a ) , ra ) && same_content( ft::intersection( a , a ) , ra ) , "merge_union / intersection with itself" );
+	check( ft::difference( a , a ).empty() , "difference with itself" );
+
+	//  Outputs are only replaced once all three are built : from may be one of them  //
+	ft::map< int , int , Compare >	b( a ) , from( a ) , added , removed , changed;
+
+	b.erase( a.begin()->first );
+	b[( ++a.begin() )->first] += 5;
+	b[-1] = 7;
+	ft::diff( a , b , added , removed , changed );
+	check( added.size() == 1 && removed.size() == 1 && changed.size() == 1 , "diff() with one of each" );
+	ft::diff( from , b , from , removed , changed );
+	check( from == added && removed.size() == 1 && changed.size() == 1 , "diff() into its own input" );
+	cout << "set algebra " << name << ": done\n";
+}
+
+int main( void )
+{
+	set_algebra_tests< std::less< int > >( "std::less" );
+	set_algebra_tests< std::greater< int > >( "std::greater" );
+	return ( checks_result() );
+}
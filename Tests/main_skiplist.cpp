@@ -0,0 +1,272 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_skiplist.cpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:02:33 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../Includes/Containers/concurrent_skiplist_map.hpp"
+#include "test_utils.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include <map>
+#include <pthread.h>
+
+using std::cout;
+
+//  Allocator counting the blocks it has handed out and not yet taken back, and their peak  //
+static long	g_blocks = 0;
+static long	g_peak = 0;
+
+template< class T >
+class counting_allocator : public std::allocator< T >
+{
+	public :
+
+		template< class U >
+		struct rebind
+		{
+			typedef counting_allocator< U >	other;
+		};
+
+		counting_allocator( void ) {}
+		counting_allocator( const counting_allocator& x ) : std::allocator< T >( x ) {}
+		template< class U >
+		counting_allocator( const counting_allocator< U >& x ) : std::allocator< T >( x ) {}
+
+		T*	allocate( std::size_t n , const void* = 0 )
+		{
+			long	now = __sync_add_and_fetch( &g_blocks , 1 );
+			long	peak = __sync_fetch_and_add( &g_peak , 0 );
+
+			while ( now > peak && !__sync_bool_compare_and_swap( &g_peak , peak , now ) )
+				peak = __sync_fetch_and_add( &g_peak , 0 );
+			return ( std::allocator< T >::allocate( n ) );
+		}
+
+		void	deallocate( T* p , std::size_t n )
+		{
+			__sync_sub_and_fetch( &g_blocks , 1 );
+			std::allocator< T >::deallocate( p , n );
+			return ;
+		}
+};
+
+typedef ft::concurrent_skiplist_map< int , int , std::less< int > , counting_allocator< ft::pair< const int , int > > >	map_type;
+typedef std::map< int , int >																							ref_type;
+
+//  Random single thread operations, replayed on std::map  //
+static void	std_map_tests()
+{
+	cout << "--- concurrent_skiplist_map against std::map ---\n";
+	map_type	m;
+	ref_type	ref;
+
+	std::srand( 21 );
+	for ( int round = 0 ; round < 40000 ; ++round )
+	{
+		int	k = std::rand() % 3000;
+		int	op = std::rand() % 5;
+		int	obj = 0;
+
+		if ( op < 2 )
+			check( m.insert( ft::make_pair( k , round ) ) == ref.insert( std::make_pair( k , round ) ).second , "insert()" );
+		else if ( op == 2 )
+			check( m.erase( k ) == ref.erase( k ) , "erase()" );
+		else if ( op == 3 )
+		{
+			check( m.find( k , obj ) == ( ref.count( k ) == 1 ) && ( !ref.count( k ) || obj == ref[ k ] ) , "find( k , obj )" );
+			check( ( m.find( k ) == m.end() ) == !ref.count( k ) && m.count( k ) == ref.count( k ) , "find() and count()" );
+		}
+		else
+		{
+			map_type::const_iterator	lb = m.lower_bound( k );
+			map_type::const_iterator	ub = m.upper_bound( k );
+			ref_type::const_iterator	slb = ref.lower_bound( k );
+			ref_type::const_iterator	sub = ref.upper_bound( k );
+
+			check( ( lb == m.end() ) == ( slb == ref.end() ) && ( slb == ref.end() || lb->first == slb->first ) , "lower_bound()" );
+			check( ( ub == m.end() ) == ( sub == ref.end() ) && ( sub == ref.end() || ub->first == sub->first ) , "upper_bound()" );
+		}
+	}
+	check( same_content( m , ref ) , "final content" );
+
+	std::vector< ft::pair< int , int > >	input;
+
+	for ( int i = 0 ; i < 100 ; ++i )
+		input.push_back( ft::make_pair( i % 37 , i ) );
+
+	map_type	built( input.begin() , input.end() );
+
+	check( built.size() == 37 && built.begin()->second == 0 , "range constructor keeps the first of equal keys" );
+	cout << "concurrent_skiplist_map against std::map: done\n";
+}
+
+//  More live maps than a process has thread specific keys ( PTHREAD_KEYS_MAX is 1024 on Linux ), twice over : the  //
+//  second round reuses the first one's addresses, the thread's slots of the gone maps must not be taken for theirs  //
+static void	many_maps_tests()
+{
+	cout << "--- 1100 live concurrent_skiplist_map ---\n";
+	const int					count = 1100;
+	std::vector< map_type* >	maps;
+	bool						ok = true;
+
+	for ( int round = 0 ; round < 2 ; ++round )
+	{
+		for ( int i = 0 ; i < count ; ++i )
+		{
+			maps.push_back( new map_type() );
+			maps.back()->insert( ft::make_pair( i , round ) );
+		}
+		for ( int i = 0 ; i < count ; ++i )
+		{
+			int	obj = -1;
+
+			ok = ok && maps[ i ]->find( i , obj ) && obj == round && maps[ i ]->erase( i ) == 1 && maps[ i ]->empty();
+			delete maps[ i ];
+		}
+		maps.clear();
+	}
+	check( ok , "every map works" );
+	cout << "1100 live concurrent_skiplist_map: done\n";
+}
+
+//  Six writers own the keys equal to their id modulo 6, every mapped value is twice its key  //
+//  At most 12000 keys are linked at once : without reclamation the erased nodes would pile up far beyond  //
+static const int	g_writers = 6;
+static const int	g_readers = 2;
+static map_type*	g_map = NULL;
+static int			g_done = 0;
+
+struct writer_job
+{
+	int			id;
+	ref_type	ref;
+	bool		ok;
+};
+
+struct reader_job
+{
+	bool	ok;
+	long	seen;
+};
+
+static void*	writer( void* arg )
+{
+	writer_job*		job = static_cast< writer_job* >( arg );
+	unsigned int	seed = job->id + 1;
+	int				obj = 0;
+
+	job->ok = true;
+	for ( int i = 0 ; i < 80000 ; ++i )
+	{
+		int	k = ( rand_r( &seed ) % 2000 ) * g_writers + job->id;
+		int	op = rand_r( &seed ) % 3;
+
+		if ( op == 0 )
+		{
+			if ( g_map->insert( ft::make_pair( k , k * 2 ) ) != !job->ref.count( k ) )
+				job->ok = false;
+			job->ref.insert( std::make_pair( k , k * 2 ) );
+		}
+		else if ( op == 1 )
+		{
+			if ( g_map->erase( k ) != job->ref.erase( k ) )
+				job->ok = false;
+		}
+		else if ( g_map->find( k , obj ) != ( job->ref.count( k ) == 1 ) )
+			job->ok = false;
+	}
+	return ( NULL );
+}
+
+static void*	reader( void* arg )
+{
+	reader_job*	job = static_cast< reader_job* >( arg );
+
+	job->ok = true;
+	job->seen = 0;
+	while ( !__sync_fetch_and_add( &g_done , 0 ) )
+	{
+		int	prev = -1;
+
+		for ( map_type::const_iterator it = g_map->begin() ; it != g_map->end() ; ++it , ++job->seen )
+		{
+			if ( it->first <= prev || it->second != it->first * 2 )
+				job->ok = false;
+			prev = it->first;
+		}
+
+		map_type::const_iterator	lb = g_map->lower_bound( 5000 );
+
+		if ( lb != g_map->end() && lb->first < 5000 )
+			job->ok = false;
+	}
+	return ( NULL );
+}
+
+static void	threaded_tests()
+{
+	cout << "--- concurrent_skiplist_map with " << g_writers << " writers and " << g_readers << " readers ---\n";
+	const long	start = g_blocks;
+
+	g_peak = start;
+	{
+		map_type		m;
+		writer_job		writers[ g_writers ];
+		reader_job		readers[ g_readers ];
+		pthread_t		threads[ g_writers + g_readers ];
+		ref_type		ref;
+
+		g_map = &m;
+		for ( int t = 0 ; t < g_readers + g_writers ; ++t )
+		{
+			int	failed;
+
+			if ( t < g_readers )
+				failed = pthread_create( &threads[ t ] , NULL , reader , &readers[ t ] );
+			else
+			{
+				writers[ t - g_readers ].id = t - g_readers;
+				failed = pthread_create( &threads[ t ] , NULL , writer , &writers[ t - g_readers ] );
+			}
+			if ( failed )
+			{
+				cout << "KO: pthread_create()\n";
+				std::exit( 1 );
+			}
+		}
+		for ( int t = g_readers ; t < g_readers + g_writers ; ++t )
+			pthread_join( threads[ t ] , NULL );
+		__sync_fetch_and_add( &g_done , 1 );
+		for ( int t = 0 ; t < g_readers ; ++t )
+			pthread_join( threads[ t ] , NULL );
+		for ( int r = 0 ; r < g_readers ; ++r )
+			check( readers[ r ].ok , "readers only see sorted keys with their values" );
+		for ( int w = 0 ; w < g_writers ; ++w )
+		{
+			check( writers[ w ].ok , "each writer sees its own keys as it left them" );
+			ref.insert( writers[ w ].ref.begin() , writers[ w ].ref.end() );
+		}
+		check( same_content( m , ref ) , "final content is what every writer did" );
+		check( g_peak - start < 3 * g_writers * 2000 , "erased nodes reclaimed while threads run" );
+	}
+	check( g_blocks == start , "every node freed with the map" );
+	cout << "concurrent_skiplist_map with " << g_writers << " writers and " << g_readers << " readers: done\n";
+}
+
+int main( void )
+{
+	std_map_tests();
+	many_maps_tests();
+	threaded_tests();
+	return ( checks_result() );
+}
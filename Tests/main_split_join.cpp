@@ -0,0 +1,144 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_split_join.cpp                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:21:09 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include <map>
+
+#include "../Includes/Containers/map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  Allocator counting the bytes it has handed out and not yet taken back  //
+static std::size_t	g_live = 0;
+
+template< class T >
+class counting_allocator : public std::allocator< T >
+{
+	public :
+
+		template< class U >
+		struct rebind
+		{
+			typedef counting_allocator< U >	other;
+		};
+
+		counting_allocator( void ) {}
+		counting_allocator( const counting_allocator& x ) : std::allocator< T >( x ) {}
+		template< class U >
+		counting_allocator( const counting_allocator< U >& x ) : std::allocator< T >( x ) {}
+
+		T*	allocate( std::size_t n , const void* = 0 )
+		{
+			g_live += n * sizeof( T );
+			return ( std::allocator< T >::allocate( n ) );
+		}
+
+		void	deallocate( T* p , std::size_t n )
+		{
+			g_live -= n * sizeof( T );
+			std::allocator< T >::deallocate( p , n );
+		}
+};
+
+typedef ft::map< int , int , std::less< int > , counting_allocator< ft::pair< const int , int > > >	map_type;
+
+static void	split_join_tests()
+{
+	cout << "--- split / join ---\n";
+	map_type				m;
+	std::map< int , int >	ref;
+
+	for ( int i = 0 ; i < 100 ; i++ )
+	{
+		m[i * 2] = i;
+		ref[i * 2] = i;
+	}
+	map_type::iterator	kept = m.find( 120 );
+	map_type			upper;
+
+	m.split( 101 , upper );
+	std::map< int , int >	ref_upper( ref.lower_bound( 101 ) , ref.end() );
+
+	ref.erase( ref.lower_bound( 101 ) , ref.end() );
+	check( same_content( m , ref ) && same_content( upper , ref_upper ) , "split halves" );
+	check( kept == upper.find( 120 ) , "iterators follow the moved nodes" );
+	check( upper.join( m ) , "join in either order" );
+	check( upper.size() == 100 && m.empty() && upper.begin()->first == 0 , "join before" );
+	map_type	overlap;
+	overlap[51] = 0;
+	check( !upper.join( overlap ) && overlap.size() == 1 && upper.size() == 100 , "overlapping join is refused" );
+	map_type	rest;
+
+	rest[7] = 7;
+	m.split( 0 , rest );
+	check( rest.empty() , "split of empty clears out" );
+	upper.split( 1000 , rest );
+	check( rest.empty() && upper.size() == 100 , "split past the end" );
+	cout << "split / join: done\n";
+}
+
+//  Repartition in a loop : elements freed on one side are allocated on the other, live memory must stay bounded  //
+static void	repartition_tests( bool free_below )
+{
+	cout << "--- repartition, " << ( free_below ? "erase below" : "erase above" ) << " ---\n";
+	std::size_t	start = g_live;
+	std::size_t	settled = 0;
+	std::size_t	peak = 0;
+	{
+		map_type	m;
+		int			low = 0;
+		int			high = 2000;
+
+		for ( int i = low ; i < high ; i++ )
+			m[i] = i;
+		for ( int round = 0 ; round < 3000 ; round++ )
+		{
+			map_type	r;
+
+			m.split( low + 1000 , r );
+
+			for ( int i = 0 ; i < 500 ; i++ )
+			{
+				if ( free_below )
+				{
+					m.erase( low++ );
+					r[high++] = round;
+				}
+				else
+				{
+					r.erase( --high );
+					m[--low] = round;
+				}
+			}
+			check( m.join( r ) && r.empty() , "join after repartition" );
+			if ( round == 100 )
+				settled = g_live - start;
+			if ( g_live - start > peak )
+				peak = g_live - start;
+		}
+		check( m.size() == 2000 && m.begin()->first == low && ( --m.end() )->first == high - 1 , "elements after repartition" );
+	}
+	check( g_live == start , "every chunk is given back" );
+	check( peak <= settled * 2 , "live memory stays bounded" );
+	cout << "live bytes after 100 rounds: " << settled << ", peak over 3000 rounds: " << peak << '\n';
+}
+
+int main( void )
+{
+	split_join_tests();
+	repartition_tests( true );
+	repartition_tests( false );
+	return ( checks_result() );
+}
@@ -496,7 +496,7 @@ void map_tests()
 	display_range(m3.begin(), m3.end());
 	std::cout << "m2 size: " << m2.size() <<
 		"\nm3 size: " << m3.size() << '\n';
-	// NAMESPACE::swap(m2, m3);
+	NAMESPACE::swap(m2, m3);
 	display_range(m2.begin(), m2.end());
 	display_range(m3.begin(), m3.end());
 	map<int, float> ok;
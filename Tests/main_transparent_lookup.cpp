@@ -0,0 +1,185 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   main_transparent_lookup.cpp                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:23:51 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:38:51 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <new>
+#include <map>
+
+#include "../Includes/Containers/map.hpp"
+#include "test_utils.hpp"
+
+using std::cout;
+
+//  Every heap allocation of the program is counted  //
+static long	g_allocations = 0;
+
+void*	operator new( std::size_t n ) throw( std::bad_alloc )
+{
+	void*	ret = std::malloc( n ? n : 1 );
+
+	if ( !ret )
+		throw ( std::bad_alloc() );
+	++g_allocations;
+	return ( ret );
+}
+
+void	operator delete( void* p ) throw()
+{
+	std::free( p );
+	return ;
+}
+
+//  Part of a buffer, never turned into a std::string  //
+struct key_slice
+{
+	const char*	data;
+	std::size_t	len;
+
+	key_slice( const char* d , std::size_t l ) : data( d ) , len( l ) {}
+};
+
+//  slice_less : orders std::string keys and key_slice probes together  //
+struct slice_less
+{
+	typedef void	is_transparent;
+
+	static int	compare( const char* a , std::size_t alen , const char* b , std::size_t blen )
+	{
+		int	ret = std::memcmp( a , b , alen < blen ? alen : blen );
+
+		if ( ret )
+			return ( ret );
+		return ( alen < blen ? -1 : alen > blen );
+	}
+
+	bool	operator()( const std::string& a , const std::string& b ) const
+	{
+		return ( a < b );
+	}
+
+	bool	operator()( const std::string& a , const key_slice& b ) const
+	{
+		return ( compare( a.data() , a.size() , b.data , b.len ) < 0 );
+	}
+
+	bool	operator()( const key_slice& a , const std::string& b ) const
+	{
+		return ( compare( a.data , a.len , b.data() , b.size() ) < 0 );
+	}
+};
+
+static void	key_name( char* buf , int i )
+{
+	std::sprintf( buf , "request-header-field-%05d" , i );
+	return ;
+}
+
+//  const char* probes through transparent_less : same answers as std::map, no allocation  //
+static void	pointer_probe_tests()
+{
+	cout << "--- map transparent lookup with const char* ---\n";
+	typedef ft::map< std::string , int , ft::transparent_less >	map_type;
+	map_type						m;
+	std::map< std::string , int >	ref;
+	char							buf[ 64 ];
+
+	for ( int i = 0 ; i < 2000 ; i += 2 )
+	{
+		key_name( buf , i );
+		m[ buf ] = i;
+		ref[ buf ] = i;
+	}
+
+	const map_type&	cm = m;
+	std::vector< int >	found( 2100 );
+	std::vector< int >	counted( 2100 );
+	std::vector< int >	above( 2100 );
+	long				before = g_allocations;
+	bool				same = true;
+
+	for ( int i = 0 ; i < 2100 ; ++i )
+	{
+		const char*			probe = buf;
+		map_type::iterator	it;
+
+		key_name( buf , i );
+		it = m.find( probe );
+		found[ i ] = ( it == m.end() ) ? -1 : it->second;
+		counted[ i ] = m.count( probe );
+		it = m.upper_bound( probe );
+		above[ i ] = ( it == m.end() ) ? -1 : it->second;
+		same = same && cm.equal_range( probe ).first == cm.lower_bound( probe );
+	}
+	check( g_allocations == before , "no allocation per lookup" );
+	for ( int i = 0 ; i < 2100 ; ++i )
+	{
+		std::map< std::string , int >::iterator	it;
+
+		key_name( buf , i );
+		it = ref.find( buf );
+		same = same && found[ i ] == ( it == ref.end() ? -1 : it->second );
+		same = same && counted[ i ] == static_cast< int >( ref.count( buf ) );
+		it = ref.upper_bound( buf );
+		same = same && above[ i ] == ( it == ref.end() ? -1 : it->second );
+	}
+	check( same , "answers of std::map" );
+	cout << "map transparent lookup with const char*: done\n";
+}
+
+//  Probes of another type, compared through a user comparator  //
+static void	slice_probe_tests()
+{
+	cout << "--- map transparent lookup with buffer slices ---\n";
+	typedef ft::map< std::string , int , slice_less >	map_type;
+	map_type	m;
+	const char*	line = "GET /index HTTP/1.1 Host: example Accept: text";
+	const char*	words[] = { "GET" , "/index" , "HTTP/1.1" , "Host:" , "example" };
+
+	for ( int i = 0 ; i < 5 ; ++i )
+		m[ words[ i ] ] = i;
+
+	long	before = g_allocations;
+	int		found = 0;
+	int		order = 0;
+
+	for ( const char* start = line ; *start ; )
+	{
+		const char*	end = start;
+
+		while ( *end && *end != ' ' )
+			++end;
+
+		map_type::iterator	it = m.find( key_slice( start , end - start ) );
+
+		if ( it != m.end() && it->first.compare( 0 , std::string::npos , start , end - start ) == 0 )
+			++found;
+		if ( m.lower_bound( key_slice( start , 0 ) ) == m.begin() )
+			++order;
+		start = *end ? end + 1 : end;
+	}
+	check( g_allocations == before , "no allocation per slice lookup" );
+	check( found == 5 && order == 7 , "every word found, the empty slice first" );
+	check( m.count( key_slice( "Host: example" , 4 ) ) == 0 && m.count( key_slice( "Host: example" , 5 ) ) == 1 , "slice length is honoured" );
+	cout << "map transparent lookup with buffer slices: done\n";
+}
+
+int main( void )
+{
+	pointer_probe_tests();
+	slice_probe_tests();
+	return ( checks_result() );
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   test_utils.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: I-lan <I-lan@student.42.fr>                +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:31:08 by I-lan             #+#    #+#             */
+/*   Updated: 2026/10/18 14:31:08 by I-lan            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TEST_UTILS_HPP
+# define TEST_UTILS_HPP
+
+# include <iostream>
+# include <cstddef>
+
+/*
+
+Helpers shared by the Tests/main_*.cpp programs : every program is a single 
+translation unit built against std::map as a reference, prints "KO: ..." for 
+each failed check and exits non zero if any failed.
+
+*/
+
+//  failed_checks() : number of check() calls that failed so far  //
+inline int&	failed_checks( void )
+{
+	static int	failed = 0;
+
+	return ( failed );
+}
+
+//  check() : prints what failed, flushed in case a later test crashes on the broken container, the program goes on  //
+inline void	check( bool ok , const char* what )
+{
+	if ( !ok )
+	{
+		std::cout << "KO: " << what << std::endl;
+		++failed_checks();
+	}
+	return ;
+}
+
+//  checks_result() : value for main() to return, 0 when every check passed  //
+inline int	checks_result( void )
+{
+	if ( failed_checks() )
+		std::cout << failed_checks() << " check(s) failed\n";
+	return ( failed_checks() != 0 );
+}
+
+//  next_rand() : small LCG in [0, bound[, the same sequence on every run and every libc  //
+inline int	next_rand( int bound )
+{
+	static unsigned long	seed = 42;
+
+	seed = seed * 1103515245UL + 12345UL;
+	return ( static_cast< int >( ( seed >> 16 ) % static_cast< unsigned long >( bound ) ) );
+}
+
+//  same_content() : both maps hold the same elements in the same order  //
+template< class FtMap , class StdMap >
+bool	same_content( const FtMap& m , const StdMap& ref )
+{
+	typename FtMap::const_iterator	it = m.begin();
+	typename StdMap::const_iterator	sit = ref.begin();
+
+	if ( m.size() != ref.size() )
+		return ( false );
+	for ( ; sit != ref.end() ; ++it , ++sit )
+	{
+		if ( it == m.end() || it->first != sit->first || it->second != sit->second )
+			return ( false );
+	}
+	return ( it == m.end() );
+}
+
+//  same_both_ways() : same_content(), and the reverse walk agrees too  //
+template< class FtMap , class StdMap >
+bool	same_both_ways( const FtMap& m , const StdMap& ref )
+{
+	typename FtMap::const_reverse_iterator	rit = m.rbegin();
+	typename StdMap::const_reverse_iterator	rsit = ref.rbegin();
+
+	if ( !same_content( m , ref ) )
+		return ( false );
+	for ( ; rsit != ref.rend() ; ++rit , ++rsit )
+	{
+		if ( rit->first != rsit->first || rit->second != rsit->second )
+			return ( false );
+	}
+	return ( rit == m.rend() );
+}
+
+//  same_elements() : for unordered containers, every element met once with the value ref holds  //
+template< class Map , class StdMap >
+bool	same_elements( const Map& m , const StdMap& ref )
+{
+	std::size_t	seen = 0;
+
+	for ( typename Map::const_iterator it = m.begin() ; it != m.end() ; ++it , ++seen )
+	{
+		typename StdMap::const_iterator	r = ref.find( it->first );
+
+		if ( r == ref.end() || r->second != it->second )
+			return ( false );
+	}
+	return ( seen == ref.size() && m.size() == ref.size() );
+}
+
+#endif